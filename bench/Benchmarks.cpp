@@ -0,0 +1,431 @@
+#include "AI.h"
+#include "BatchEval.h"
+#include "Card.h"
+#include "Dealer.h"
+#include "DealerOdds.h"
+#include "Game.h"
+#include "Input.h"
+#include "Player.h"
+#include "SeatTable.h"
+#include "Shoe.h"
+#include "ShoeFeeder.h"
+#include "Simulation.h"
+#include "Stats.h"
+#include <chrono> //steady_clock for timing each benchmark
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//Rule set the round benchmarks play: dealer stands on soft 17, blackjack pays 3:2, doubling and splitting allowed
+typedef Rules<false, false, true, true> BenchRules;
+
+//Output stream buffer that throws away everything written to it, so the interactive game benchmarks time building the frames and not the terminal
+class NullBuffer : public streambuf{
+protected:
+    int overflow(int c) override{
+        return c;
+    }
+    
+    streamsize xsputn(const char*, streamsize n) override{
+        return n;
+    }
+};
+
+//Plays n rounds of the interactive game from a script at the given verbosity, with every frame rendered and thrown away
+static void benchGame(long long n, Verbosity verbosity){
+    SimulationConfig config;
+    config.seed = 1;
+    config.decks = 6;
+    config.gameRounds = n;
+    istringstream script("1 bench 1"); //One player and one AI; once the script runs out the player stays every turn
+    Input input(script, true);
+    NullBuffer discard;
+    ostream out(&discard);
+    Renderer render(verbosity, out);
+    playGame(config, render, input);
+}
+
+//Result of one benchmark: how many times the body ran in the timed run and the average time per run
+struct BenchmarkResult{
+    string name;
+    long long iterations;
+    double nsPerOp;
+};
+
+//Stops the compiler from optimizing away a value the benchmark computed
+template <typename T>
+void keep(const T& value){
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+//Runs body(iterations) with a doubling number of iterations until one run takes at least minSeconds, then reports the average time of that run
+template <typename Body>
+BenchmarkResult runBenchmark(const string& name, Body body, double minSeconds){
+    long long iterations = 1;
+    while(true){
+        auto start = chrono::steady_clock::now();
+        body(iterations);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if(seconds >= minSeconds || iterations >= (1LL << 40)){
+            return BenchmarkResult{name, iterations, seconds * 1e9 / iterations};
+        }
+        iterations *= 2;
+    }
+}
+
+//Deals a fixed hand to a seat: the hand total benchmarks read the total of this hand
+template <typename Seat>
+void dealBenchmarkHand(Seat& seat, Shoe& shoe){
+    seat.resetHand();
+    seat.addCard(shoe);
+    seat.addCard(shoe);
+    seat.addCard(shoe);
+}
+
+//Writes the results as JSON so runs on different commits can be compared
+void writeJson(ostream& out, const vector<BenchmarkResult>& results){
+    out << "{\n  \"context\": {\"timestamp\": " << time(0) << "},\n  \"benchmarks\": [\n";
+    for(size_t i = 0; i < results.size(); i++){
+        out << "    {\"name\": \"" << results[i].name << "\", \"iterations\": " << results[i].iterations << ", \"ns_per_op\": " << results[i].nsPerOp << "}";
+        out << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char* argv[]){
+    double minSeconds = 0.2; //Shortest timed run for each benchmark
+    string filter; //Only benchmarks whose name contains this are run
+    string jsonPath; //Where to write the JSON results, stdout if empty
+    
+    for(int i = 1; i < argc; i++){
+        string arg = argv[i];
+        if(arg == "--min-time" && i + 1 < argc){
+            minSeconds = atof(argv[++i]);
+        }else if(arg == "--filter" && i + 1 < argc){
+            filter = argv[++i];
+        }else if(arg == "--json" && i + 1 < argc){
+            jsonPath = argv[++i];
+        }else{
+            cerr << "Usage: " << argv[0] << " [--min-time SECONDS] [--filter NAME] [--json FILE]" << endl;
+            return 1;
+        }
+    }
+    
+    vector<BenchmarkResult> results;
+    auto run = [&](const string& name, auto body){
+        if(name.find(filter) == string::npos){
+            return;
+        }
+        BenchmarkResult result = runBenchmark(name, body, minSeconds);
+        cerr << name << ": " << result.nsPerOp << " ns/op (" << result.iterations << " iterations)" << endl;
+        results.push_back(result);
+    };
+    
+    run("createDeck", [](long long n){
+        for(long long i = 0; i < n; i++){
+            vector<Card> deck = createDeck();
+            keep(deck.data());
+        }
+    });
+    
+    run("shuffleCards/1deck", [](long long n){
+        vector<Card> deck = createDeck();
+        Rng rng(1);
+        for(long long i = 0; i < n; i++){
+            shuffleCards(deck, rng);
+            keep(deck[0].bits);
+        }
+    });
+    
+    run("shuffleCards/6decks", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        for(long long i = 0; i < n; i++){
+            shoe.shuffle();
+            keep(shoe.draw().bits);
+        }
+    });
+    
+    //The same reshuffle with a feeder thread preparing the shoes, so the table only swaps vectors when it can keep up
+    run("Shoe::shuffle/6decks/fed", [](long long n){
+        ShoeFeeder feeder;
+        Shoe shoe(6, 0.75, 1);
+        shoe.attach(feeder);
+        for(long long i = 0; i < n; i++){
+            shoe.shuffle();
+            keep(shoe.draw().bits);
+        }
+    });
+    
+    run("Dealer::calculateHT", [](long long n){
+        Shoe shoe(1, 0.75, 1);
+        Dealer dealer;
+        dealBenchmarkHand(dealer, shoe);
+        for(long long i = 0; i < n; i++){
+            keep(dealer.calculateHT());
+        }
+    });
+    
+    run("Player::calculateHT", [](long long n){
+        Shoe shoe(1, 0.75, 1);
+        Player player("Bench");
+        dealBenchmarkHand(player, shoe);
+        for(long long i = 0; i < n; i++){
+            keep(player.calculateHT());
+        }
+    });
+    
+    run("AI::calculateHT", [](long long n){
+        Shoe shoe(1, 0.75, 1);
+        AI bot;
+        dealBenchmarkHand(bot, shoe);
+        for(long long i = 0; i < n; i++){
+            keep(bot.calculateHT());
+        }
+    });
+    
+    run("AI::play/basicStrategy", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        AI bot;
+        for(long long i = 0; i < n; i++){
+            checkDeckSize(shoe);
+            Card upcard = shoe.draw();
+            bot.resetHand();
+            bot.addCard(shoe);
+            bot.addCard(shoe);
+            bot.play<BenchRules>(shoe, upcard);
+            keep(bot.getTotal());
+        }
+    });
+    
+    run("interactiveRound/full", [](long long n){
+        benchGame(n, FULL);
+    });
+    
+    run("interactiveRound/quiet", [](long long n){
+        benchGame(n, QUIET);
+    });
+    
+    run("Dealer::play", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        for(long long i = 0; i < n; i++){
+            checkDeckSize(shoe);
+            dealer.resetHand();
+            dealer.addCard(shoe);
+            dealer.addCard(shoe);
+            dealer.play(shoe);
+            keep(dealer.getTotal());
+        }
+    });
+    
+    run("headlessRound/1seat", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(1);
+        SeatTable table(1);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getWins(0));
+    });
+    
+    run("headlessRound/7seats", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getWins(0));
+    });
+    
+    run("headlessRound/7seats/fed", [](long long n){
+        ShoeFeeder feeder;
+        Shoe shoe(6, 0.75, 1);
+        shoe.attach(feeder);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getWins(0));
+    });
+    
+    //The same rounds with the simulation's running statistics collected after each one
+    run("headlessRound/7seats/stats", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        RoundStats stats;
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+            stats.addRound(table, dealer);
+        }
+        stats.endBlock();
+        keep(stats.roundNet.mean);
+    });
+    
+    //Seven AIs counting cards with a 1-8 bet spread and the count's index plays
+    run("headlessRound/7seats/counting", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7, AI(BASIC_STRATEGY, 8));
+        SeatTable table(7);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getNet(0));
+    });
+    
+    //Every round dealt from its own fresh shoe, as the strategy optimizer plays them
+    run("headlessRound/7seats/roundShoe", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        for(long long i = 0; i < n; i++){
+            shoe.startRound(1, 0, i);
+            playHeadlessRound<BenchRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getNet(0));
+    });
+    
+    run("headlessRound/7seats/hitStand", [](long long n){
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<HitStandRules>(shoe, dealer, bot, table);
+        }
+        keep(table.getWins(0));
+    });
+    
+    run("headlessRound/7seats/logged", [](long long n){
+        //Logs every round to /dev/null, a block's worth of rounds at a time like the simulation does
+        Shoe shoe(6, 0.75, 1);
+        Dealer dealer;
+        vector<AI> bot(7);
+        SeatTable table(7);
+        LogFile file;
+        file.open("/dev/null");
+        RoundLog log(&file);
+        for(long long i = 0; i < n; i++){
+            playHeadlessRound<BenchRules, true>(shoe, dealer, bot, table, &log);
+            if(i % ROUNDS_PER_BLOCK == ROUNDS_PER_BLOCK - 1){
+                log.flush();
+            }
+        }
+        log.flush();
+        keep(table.getWins(0));
+    });
+    
+    run("SeatTable::settle/4096seats", [](long long n){
+        //Fills the table with a spread of hands once, then settles it against a changing dealer total
+        Shoe shoe(6, 0.75, 1);
+        SeatTable table(4096);
+        Hand hand;
+        for(int seat = 0; seat < table.size(); seat++){
+            hand.clear();
+            while(hand.getTotal() < 12 + seat % 11){
+                hand.add(shoe.draw());
+            }
+            table.record(seat, hand);
+        }
+        for(long long i = 0; i < n; i++){
+            table.settle(17 + i % 6);
+        }
+        keep(table.getWins(0));
+    });
+    
+    run("DealerOdds::dealerOutcomes/6decks/cold", [](long long n){
+        //Every query starts with an empty memo: the full cost of walking the dealer's hands
+        ShoeComposition shoe = ShoeComposition::fullShoe(6);
+        shoe.counts[8]--;
+        for(long long i = 0; i < n; i++){
+            DealerOdds odds;
+            keep(odds.dealerOutcomes(8, shoe)[FINAL_BUST]);
+        }
+    });
+    
+    run("DealerOdds::dealerOutcomes/6decks/warm", [](long long n){
+        ShoeComposition shoe = ShoeComposition::fullShoe(6);
+        shoe.counts[8]--;
+        DealerOdds odds;
+        for(long long i = 0; i < n; i++){
+            keep(odds.dealerOutcomes(8, shoe)[FINAL_BUST]);
+        }
+    });
+    
+    run("DealerOdds::decisionEV/16v10/6decks", [](long long n){
+        //Hard 16 (10 + 6) against a dealer 10, from a fresh memo each time
+        ShoeComposition shoe = ShoeComposition::fullShoe(6);
+        shoe.counts[8] -= 2;
+        shoe.counts[4]--;
+        for(long long i = 0; i < n; i++){
+            DealerOdds odds;
+            keep(odds.decisionEV(16, false, 8, shoe).hit);
+        }
+    });
+    
+    //Batch evaluation of 16384 random hands. Every kernel is checked against the Hand class before it is timed
+    const int batchHands = 16384;
+    HandBatch batch;
+    batch.reset(batchHands);
+    vector<Hand> batchSource(batchHands);
+    Shoe batchShoe(6, 0.75, 1);
+    for(int i = 0; i < batchHands; i++){
+        checkDeckSize(batchShoe);
+        int target = 12 + i % 10; //Hit until reaching a spread of totals, like a seat standing on 12-21
+        while(batchSource[i].getTotal() < target){
+            batchSource[i].add(batchShoe.draw());
+        }
+        batch.set(i, batchSource[i]);
+    }
+    const BatchKernel kernels[] = {KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2};
+    const char* const kernelNames[] = {"scalar", "sse2", "avx2"};
+    for(int k = 0; k < 3; k++){
+        if(!batchKernelSupported(kernels[k])){
+            continue;
+        }
+        BatchResult checkResult;
+        evaluateHands(batch, checkResult, kernels[k]);
+        for(int i = 0; i < batchHands; i++){
+            const Hand& hand = batchSource[i];
+            if(checkResult.totals[i] != hand.getTotal() || checkResult.soft[i] != hand.isSoft() || checkResult.bust[i] != hand.isBust()){
+                cerr << "evaluateHands/" << kernelNames[k] << " disagrees with Hand on hand " << i << endl;
+                return 1;
+            }
+        }
+        BatchKernel kernel = kernels[k];
+        run(string("evaluateHands/") + kernelNames[k] + "/16384hands", [&batch, kernel](long long n){
+            BatchResult result;
+            for(long long i = 0; i < n; i++){
+                evaluateHands(batch, result, kernel);
+                keep(result.totals[0]);
+            }
+        });
+    }
+    
+    if(jsonPath.empty()){
+        writeJson(cout, results);
+    }else{
+        ofstream out(jsonPath);
+        writeJson(out, results);
+    }
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include "DealerOdds.h"
+#include "Game.h"
+#include "Input.h"
+#include "Optimizer.h"
+#include "Renderer.h"
+#include "Server.h"
+#include "Shoe.h"
+#include "Simulation.h"
+#include <iostream> //Input output stream
+#include <fstream> //Reading a decision script
+#include <ctime> //Library used for the default seed, based off the current time
+#include <cstdlib> //atoi/atoll for reading command-line numbers
+#include <iomanip> //setw/setprecision for the dealer odds table
+#include <thread> //hardware_concurrency for the default number of simulation threads
+
+using namespace std;//Removes need to write std:: before anything used in the standard library
+
+//Prints the command-line options
+void printUsage(const char* program){
+    cout << "Usage: " << program << " [--decks N] [--penetration P] [--quiet | --summary-only] [--script FILE] [--rounds N] [--log FILE] [--serve ADDRESS] [--h17] [--6to5] [--no-double] [--no-split] [--dealer-odds] [--simulate ROUNDS] [--ai SEATS] [--threads N] [--seed SEED] [--count SPREAD] [--stats FILE] [--target-ci WIDTH] [--no-preshuffle] [--optimize ROUNDS] [--checkpoint FILE] [--overwrite-checkpoint]" << endl;
+    cout << "  --decks N          Number of decks in the shoe, 1-8 (default 1)" << endl;
+    cout << "  --penetration P    Fraction of the shoe dealt before the cut card comes out, 0.1-1 (default 0.75)" << endl;
+    cout << "  --h17              Dealer hits soft 17 (default: stands on all 17s)" << endl;
+    cout << "  --6to5             Blackjack pays 6:5 (default 3:2)" << endl;
+    cout << "  --no-double        AI seats can't double down in --simulate" << endl;
+    cout << "  --no-split         AI seats can't split pairs in --simulate" << endl;
+    cout << "  --quiet            Show hands as one line of text instead of drawing the cards" << endl;
+    cout << "  --summary-only     Only show the prompts, round results and final scores" << endl;
+    cout << "  --script FILE      Read every answer (player count, names, hit/stay, keep playing) from FILE instead of the keyboard, - for a pipe" << endl;
+    cout << "  --rounds N         Play N rounds of the interactive game without asking to keep playing" << endl;
+    cout << "  --log FILE         Append every round (shuffles, cards, decisions, results) to a binary log that blackjack_replay can read" << endl;
+    cout << "  --serve ADDRESS    Host tables for network players on a TCP port (on 127.0.0.1) or a Unix socket path, with --threads worker threads" << endl;
+    cout << "  --dealer-odds      Print the exact chance of each dealer final total for every upcard and exit" << endl;
+    cout << "  --simulate ROUNDS  Play ROUNDS rounds with only AI seats and the dealer and print the win/loss/tie rates and net result per round" << endl;
+    cout << "  --ai SEATS         Number of AI seats used by --simulate (default 1)" << endl;
+    cout << "  --threads N        Number of threads used by --simulate, or worker threads used by --serve (default: all cores)" << endl;
+    cout << "  --seed SEED        Seed for the shuffles; the same seed gives the same game, and the same --simulate results for any thread count (default: current time)" << endl;
+    cout << "  --count SPREAD     AI seats in --simulate count cards with Hi-Lo: they bet 1 bet per point of true count up to SPREAD bets (at most " << MAX_BET_SPREAD << ") and play the count's index plays" << endl;
+    cout << "  --stats FILE       Write the running statistics of --simulate to FILE a few times a second: the latest snapshot as JSON if FILE ends in .json, otherwise one CSV row per snapshot" << endl;
+    cout << "  --target-ci WIDTH  Stop --simulate early once the 95% confidence interval of the net per round is within +/- WIDTH bets" << endl;
+    cout << "  --optimize ROUNDS  Search the AI stand thresholds for the best net per round under the table rules, playing every candidate on the same shoes and halving the field until the best few have played ROUNDS rounds" << endl;
+    cout << "  --checkpoint FILE  Keep the progress of the game or of --simulate in FILE as it plays, and pick it up from there when started again with the same FILE (not with --log)" << endl;
+    cout << "  --overwrite-checkpoint  Start a new session in the --checkpoint FILE even if there's already a file there, replacing it" << endl;
+    cout << "  --no-preshuffle    Shuffle every shoe on the spot in --simulate and --serve instead of ahead of time on a background thread (the cards dealt are the same)" << endl;
+}
+
+//Prints the exact chance of each dealer final total for every upcard, dealt from a full shoe of the given number of decks
+void printDealerOdds(int decks, bool hitSoft17){
+    DealerOdds odds(hitSoft17);
+    cout << fixed << setprecision(4);
+    cout << "Dealer final totals from a fresh " << decks << "-deck shoe (dealer " << (hitSoft17 ? "hits soft 17" : "stands on 17") << ")" << endl;
+    cout << "Upcard      17      18      19      20      21    Bust" << endl;
+    const char* const upcardNames[VALUE_COUNT] = {"2", "3", "4", "5", "6", "7", "8", "9", "10", "A"};
+    for(int upcard = 0; upcard < VALUE_COUNT; upcard++){
+        ShoeComposition shoe = ShoeComposition::fullShoe(decks);
+        shoe.counts[upcard]--; //The upcard has been dealt
+        DealerDistribution dist = odds.dealerOutcomes(upcard, shoe);
+        cout << setw(6) << upcardNames[upcard];
+        for(int f = 0; f < FINAL_COUNT; f++){
+            cout << setw(8) << dist[f];
+        }
+        cout << endl;
+    }
+}
+
+int main(int argc, char* argv[]){
+    PROFILE_START(); //Prints the round profile on exit and on SIGUSR1, when built with profiling
+    SimulationConfig config;
+    config.threadNum = thread::hardware_concurrency(); //One simulation thread per core by default
+    config.seed = time(0);
+    Verbosity verbosity = FULL; //How much the interactive game prints
+    bool dealerOdds = false; //Print the dealer odds table instead of playing
+    string serveAddress; //Port or socket path to serve tables on, empty to play locally
+    string scriptPath; //Decision script the interactive game reads its answers from, empty for the keyboard
+    
+    //Reads the command-line options
+    for(int i = 1; i < argc; i++){
+        string arg = argv[i];
+        if(arg == "--simulate" && i + 1 < argc){
+            config.rounds = atoll(argv[++i]);
+        }else if(arg == "--ai" && i + 1 < argc){
+            config.aiNum = atoi(argv[++i]);
+        }else if(arg == "--threads" && i + 1 < argc){
+            config.threadNum = atoi(argv[++i]);
+        }else if(arg == "--seed" && i + 1 < argc){
+            config.seed = strtoull(argv[++i], nullptr, 10);
+        }else if(arg == "--decks" && i + 1 < argc){
+            config.decks = atoi(argv[++i]);
+        }else if(arg == "--penetration" && i + 1 < argc){
+            config.penetration = atof(argv[++i]);
+        }else if(arg == "--h17"){
+            config.hitSoft17 = true;
+        }else if(arg == "--6to5"){
+            config.sixToFive = true;
+        }else if(arg == "--no-double"){
+            config.canDouble = false;
+        }else if(arg == "--no-split"){
+            config.canSplit = false;
+        }else if(arg == "--dealer-odds"){
+            dealerOdds = true;
+        }else if(arg == "--script" && i + 1 < argc){
+            scriptPath = argv[++i];
+        }else if(arg == "--rounds" && i + 1 < argc){
+            config.gameRounds = atoll(argv[++i]);
+        }else if(arg == "--log" && i + 1 < argc){
+            config.logPath = argv[++i];
+        }else if(arg == "--serve" && i + 1 < argc){
+            serveAddress = argv[++i];
+        }else if(arg == "--count" && i + 1 < argc){
+            config.countSpread = atoi(argv[++i]);
+        }else if(arg == "--stats" && i + 1 < argc){
+            config.statsPath = argv[++i];
+        }else if(arg == "--target-ci" && i + 1 < argc){
+            config.targetWidth = atof(argv[++i]);
+        }else if(arg == "--optimize" && i + 1 < argc){
+            config.optimizeRounds = atoll(argv[++i]);
+        }else if(arg == "--checkpoint" && i + 1 < argc){
+            config.checkpointPath = argv[++i];
+        }else if(arg == "--overwrite-checkpoint"){
+            config.overwriteCheckpoint = true;
+        }else if(arg == "--no-preshuffle"){
+            config.preshuffle = false;
+        }else if(arg == "--quiet"){
+            verbosity = QUIET;
+        }else if(arg == "--summary-only"){
+            verbosity = SUMMARY_ONLY;
+        }else{
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    if(config.decks < 1 || config.decks > MAX_DECKS || config.penetration < 0.1 || config.penetration > 1 || (!config.checkpointPath.empty() && !config.logPath.empty())){
+        printUsage(argv[0]);
+        return 1;
+    }
+    
+    if(dealerOdds){
+        printDealerOdds(config.decks, config.hitSoft17);
+        return 0;
+    }
+    
+    if(!serveAddress.empty()){
+        return runServer(config, serveAddress, max(config.threadNum, 1), verbosity);
+    }
+    
+    if(config.rounds > 0 || config.optimizeRounds > 0){
+        if(config.aiNum < 1 || config.countSpread < 0 || config.countSpread > MAX_BET_SPREAD){
+            printUsage(argv[0]);
+            return 1;
+        }
+        if(config.threadNum < 1){
+            config.threadNum = 1;
+        }
+        if(config.optimizeRounds > 0){
+            optimizeStrategy(config);
+        }else{
+            simulateRounds(config);
+        }
+        return 0;
+    }
+    
+    ifstream scriptFile;
+    istream* answers = &cin;
+    if(!scriptPath.empty() && scriptPath != "-"){
+        scriptFile.open(scriptPath);
+        if(!scriptFile){
+            cout << "Can't open script " << scriptPath << endl;
+            return 1;
+        }
+        answers = &scriptFile;
+    }
+    Input input(*answers, !scriptPath.empty()); //Every answer the game reads comes from the keyboard or the script
+    Renderer render(verbosity); //Everything the game prints goes through the renderer, one write per frame
+    playGame(config, render, input);
+    
+    return 0;
+}
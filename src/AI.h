@@ -0,0 +1,155 @@
+#ifndef AI_H
+#define AI_H
+
+#include "Hand.h"
+#include "Profile.h"
+#include "Shoe.h"
+#include "Renderer.h"
+#include "Rules.h"
+#include "Strategy.h"
+#include <cmath>
+
+const int MAX_BET_SPREAD = 100; //Largest bet of a counting AI, in bets. Keeps every result within the round log's 16-bit net
+
+//AI class if the user chooses to include an AI player
+class AI{
+private:
+    //Private member of the ai's hand, which keeps its own total
+    Hand hand;
+    Hand splitHand; //Second hand after a split
+    int bet = BET_UNIT; //Bet placed on this round, before any double or split
+    int stake = BET_UNIT; //Bet on the hand, doubled by a double down
+    int splitStake = 0; //Bet on the split hand, 0 if the ai didn't split
+    const StrategyTable* strategy; //Decision table the AI plays by
+    int betSpread; //Largest bet of a counting AI in bets, 0 if the AI doesn't count
+    int trueCount = 0; //Hi-Lo true count when the round's bet was placed, rounded down
+    
+    //Looks up the decision for a hand; a counting AI plays the index plays for its true count
+    Action decide(const Hand& h, int upcard, bool canSplit){
+        Action action = lookupAction(*strategy, h, upcard, canSplit);
+        if(betSpread != 0){
+            action = deviateAction(HI_LO_DEVIATIONS, action, h, upcard, trueCount);
+        }
+        return action;
+    }
+    
+    //Plays one hand: doubles on the first two cards when the table says to and the rules allow it, otherwise hits until the table says to stand
+    template<class R>
+    void playHand(Shoe& shoe, Hand& h, int& handStake, int upcard){
+        Action action = decide(h, upcard, false);
+        if constexpr(R::CAN_DOUBLE){
+            if((action == DOUBLE || action == DOUBLE_STAND) && h.size() == 2){
+                handStake *= 2;
+                h.add(shoe.draw());
+                return;
+            }
+        }
+        while(shouldHit(action)){
+            h.add(shoe.draw());
+            if(h.isBust()){
+                break;
+            }
+            action = decide(h, upcard, false);
+        }
+    }
+public:
+    //AI constructor takes the strategy table to play by, basic strategy unless told otherwise. With a bet spread the AI counts cards with Hi-Lo: it bets one bet per point of true count, from 1 up to the spread, and plays the count's index plays
+    AI(const StrategyTable& table = BASIC_STRATEGY, int spread = 0) : strategy(&table), betSpread(spread) {}
+    
+    //Places the bet for the next round from what has come out of the shoe so far. Call it between rounds, after any reshuffle and before the cards are dealt, when every card dealt has been shown. An AI that doesn't count always bets one bet
+    void placeBet(const ShoeTracker& tracker){
+        if(betSpread == 0){
+            return;
+        }
+        trueCount = (int)std::floor(tracker.getTrueCount()); //Rounded down, so -0.5 counts as -1
+        int units = trueCount < 1 ? 1 : trueCount > betSpread ? betSpread : trueCount;
+        bet = units * BET_UNIT;
+        stake = bet;
+    }
+    
+    //Passes through the shoe by reference so the card is dealt from the shared shoe, and not from a copy.
+    void addCard(Shoe& shoe){
+        hand.add(shoe.draw()); //Add one card to the hand from the top of the shoe
+    }
+    
+    //Returns the hand total, which the hand keeps up to date as cards are added
+    int calculateHT(){
+        PROFILE_COUNT(COUNT_CALCULATE_HT);
+        return hand.getTotal();
+    }
+    
+    //Get function that returns the ai's hand
+    Hand& getHand(){
+        return hand;
+    }
+    
+    //Adds the ai's hand to the frame
+    void printHand(Renderer& render){
+        render.hand(hand);
+    }
+    
+    //Passes through shoe by reference, and plays the hand the way the strategy table says to against the dealers upcard. Doubling and splitting are only compiled in when the rules allow them; otherwise a double counts as a hit
+    template<class R>
+    void play(Shoe& shoe, Card dealerUpcard){
+        int upcard = valueIndex(dealerUpcard.rank());
+        if constexpr(R::CAN_SPLIT){
+            if(decide(hand, upcard, true) == SPLIT){
+                //Splits the pair into two hands with a bet each and deals a second card to both. Split aces only get that one card
+                Card first = hand.card(0);
+                Card second = hand.card(1);
+                hand.clear();
+                hand.add(first);
+                hand.add(shoe.draw());
+                splitHand.add(second);
+                splitHand.add(shoe.draw());
+                splitStake = bet;
+                if(first.rank() == ACE){
+                    return;
+                }
+                playHand<R>(shoe, splitHand, splitStake, upcard);
+            }
+        }
+        playHand<R>(shoe, hand, stake, upcard);
+    }
+    
+    //Returns a true/false if the hand is totaled over 21, therefore the dealer will bust
+    bool checkBust(){
+        return hand.isBust();
+    }
+    
+    //Returns the dealers hand total
+    int getTotal(){
+        return hand.getTotal();
+    }
+    
+    //Get functions for the split hand and the bets on both hands
+    Hand& getSplitHand(){
+        return splitHand;
+    }
+    
+    bool isSplit(){
+        return splitStake != 0;
+    }
+    
+    int getStake(){
+        return stake;
+    }
+    
+    int getSplitStake(){
+        return splitStake;
+    }
+    
+    //Returns the bet placed on this round
+    int getBet(){
+        return bet;
+    }
+    
+    void resetHand(){
+        hand.clear();
+        splitHand.clear();
+        stake = bet;
+        splitStake = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include "BatchEval.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+//GCC and Clang can compile the AVX2 kernel into a binary built for plain x86-64 and pick it at runtime. Other compilers only get the SSE2 kernel
+#if defined(BATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define BATCH_AVX2 1
+#endif
+
+using namespace std;
+
+void HandBatch::reset(int handCount){
+    hands = handCount;
+    stride = (handCount + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    maxCards = 0;
+    counts.assign(stride, 0);
+    cards.assign((size_t)stride * MAX_HAND_SIZE, 0);
+}
+
+void HandBatch::set(int i, const Hand& hand){
+    counts[i] = hand.size();
+    for(int c = 0; c < hand.size(); c++){
+        cards[(size_t)c * stride + i] = hand.card(c).bits;
+    }
+    maxCards = max(maxCards, hand.size());
+}
+
+//Scalar version of the kernel, used on CPUs without SIMD support
+static void evaluateScalar(const HandBatch& batch, BatchResult& result){
+    for(int i = 0; i < batch.stride; i++){
+        int hard = 0; //Total with every ace counted as 1
+        int hasAce = 0;
+        for(int c = 0; c < batch.counts[i]; c++){
+            int rank = batch.cards[(size_t)c * batch.stride + i] & 0x0F;
+            hard += rank == ACE ? 1 : CARD_VALUES[rank];
+            hasAce |= rank == ACE;
+        }
+        int soft = hasAce & (hard <= 11);
+        int total = hard + 10 * soft;
+        result.totals[i] = total;
+        result.soft[i] = soft;
+        result.bust[i] = total > 21;
+    }
+}
+
+#ifdef BATCH_X86
+//SSE2 kernel: 16 hands per step, one 8-bit lane per hand. SSE2 is part of every x86-64 CPU so it needs no runtime check there
+static void evaluateSSE2(const HandBatch& batch, BatchResult& result){
+    const __m128i rankMask = _mm_set1_epi8(0x0F);
+    const __m128i two = _mm_set1_epi8(2);
+    const __m128i ten = _mm_set1_epi8(10);
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i aceRank = _mm_set1_epi8(ACE);
+    const __m128i eleven = _mm_set1_epi8(11);
+    const __m128i twentyTwo = _mm_set1_epi8(22);
+    
+    for(int i = 0; i < batch.stride; i += 16){
+        __m128i count = _mm_loadu_si128((const __m128i*)&batch.counts[i]);
+        __m128i hard = _mm_setzero_si128();
+        __m128i hasAce = _mm_setzero_si128();
+        for(int c = 0; c < batch.maxCards; c++){
+            __m128i rank = _mm_and_si128(_mm_loadu_si128((const __m128i*)&batch.cards[(size_t)c * batch.stride + i]), rankMask);
+            __m128i active = _mm_cmpgt_epi8(count, _mm_set1_epi8(c)); //Lanes whose hand has a card in this column
+            __m128i isAce = _mm_cmpeq_epi8(rank, aceRank);
+            __m128i value = _mm_min_epu8(_mm_add_epi8(rank, two), ten); //2-9 keep their value, 10/J/Q/K (and A) cap at 10
+            value = _mm_or_si128(_mm_andnot_si128(isAce, value), _mm_and_si128(isAce, one)); //Aces count as 1
+            hard = _mm_add_epi8(hard, _mm_and_si128(value, active));
+            hasAce = _mm_or_si128(hasAce, _mm_and_si128(isAce, active));
+        }
+        __m128i soft = _mm_and_si128(hasAce, _mm_cmpeq_epi8(_mm_min_epu8(hard, eleven), hard)); //Has an ace and hard <= 11
+        __m128i total = _mm_add_epi8(hard, _mm_and_si128(soft, ten));
+        __m128i bust = _mm_cmpeq_epi8(_mm_max_epu8(total, twentyTwo), total); //total >= 22
+        _mm_storeu_si128((__m128i*)&result.totals[i], total);
+        _mm_storeu_si128((__m128i*)&result.soft[i], _mm_and_si128(soft, one));
+        _mm_storeu_si128((__m128i*)&result.bust[i], _mm_and_si128(bust, one));
+    }
+}
+#endif
+
+#ifdef BATCH_AVX2
+//AVX2 kernel: the SSE2 kernel widened to 32 hands per step
+__attribute__((target("avx2")))
+static void evaluateAVX2(const HandBatch& batch, BatchResult& result){
+    const __m256i rankMask = _mm256_set1_epi8(0x0F);
+    const __m256i two = _mm256_set1_epi8(2);
+    const __m256i ten = _mm256_set1_epi8(10);
+    const __m256i one = _mm256_set1_epi8(1);
+    const __m256i aceRank = _mm256_set1_epi8(ACE);
+    const __m256i eleven = _mm256_set1_epi8(11);
+    const __m256i twentyTwo = _mm256_set1_epi8(22);
+    
+    for(int i = 0; i < batch.stride; i += 32){
+        __m256i count = _mm256_loadu_si256((const __m256i*)&batch.counts[i]);
+        __m256i hard = _mm256_setzero_si256();
+        __m256i hasAce = _mm256_setzero_si256();
+        for(int c = 0; c < batch.maxCards; c++){
+            __m256i rank = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&batch.cards[(size_t)c * batch.stride + i]), rankMask);
+            __m256i active = _mm256_cmpgt_epi8(count, _mm256_set1_epi8(c));
+            __m256i isAce = _mm256_cmpeq_epi8(rank, aceRank);
+            __m256i value = _mm256_min_epu8(_mm256_add_epi8(rank, two), ten);
+            value = _mm256_blendv_epi8(value, one, isAce);
+            hard = _mm256_add_epi8(hard, _mm256_and_si256(value, active));
+            hasAce = _mm256_or_si256(hasAce, _mm256_and_si256(isAce, active));
+        }
+        __m256i soft = _mm256_and_si256(hasAce, _mm256_cmpeq_epi8(_mm256_min_epu8(hard, eleven), hard));
+        __m256i total = _mm256_add_epi8(hard, _mm256_and_si256(soft, ten));
+        __m256i bust = _mm256_cmpeq_epi8(_mm256_max_epu8(total, twentyTwo), total);
+        _mm256_storeu_si256((__m256i*)&result.totals[i], total);
+        _mm256_storeu_si256((__m256i*)&result.soft[i], _mm256_and_si256(soft, one));
+        _mm256_storeu_si256((__m256i*)&result.bust[i], _mm256_and_si256(bust, one));
+    }
+}
+#endif
+
+bool batchKernelSupported(BatchKernel kernel){
+    switch(kernel){
+        case KERNEL_AUTO:
+        case KERNEL_SCALAR:
+            return true;
+        case KERNEL_SSE2:
+#ifdef BATCH_X86
+            return true;
+#else
+            return false;
+#endif
+        case KERNEL_AVX2:
+#ifdef BATCH_AVX2
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+void evaluateHands(const HandBatch& batch, BatchResult& result, BatchKernel kernel){
+    result.totals.resize(batch.stride);
+    result.soft.resize(batch.stride);
+    result.bust.resize(batch.stride);
+    
+    //Picks the widest kernel the CPU supports the first time it is needed. A kernel the CPU can't run falls back to it too, instead of faulting on an illegal instruction
+    if(kernel == KERNEL_AUTO || !batchKernelSupported(kernel)){
+        static const BatchKernel best = batchKernelSupported(KERNEL_AVX2) ? KERNEL_AVX2 : batchKernelSupported(KERNEL_SSE2) ? KERNEL_SSE2 : KERNEL_SCALAR;
+        kernel = best;
+    }
+    
+    switch(kernel){
+#ifdef BATCH_AVX2
+        case KERNEL_AVX2:
+            evaluateAVX2(batch, result);
+            return;
+#endif
+#ifdef BATCH_X86
+        case KERNEL_SSE2:
+            evaluateSSE2(batch, result);
+            return;
+#endif
+        default:
+            evaluateScalar(batch, result);
+            return;
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef BATCHEVAL_H
+#define BATCHEVAL_H
+
+#include "Card.h"
+#include "Hand.h"
+#include <cstdint>
+#include <vector>
+
+//Hands are evaluated in groups of this many lanes: one 256-bit AVX2 register of 8-bit lanes. Batches are padded up to a multiple of it
+const int BATCH_LANES = 32;
+
+//HandBatch holds many independent hands (for example the same seat in thousands of simulated rounds) laid out column by column: card c of hand i is at cards[c * stride + i]
+//That way card c of 32 neighbouring hands sits in one contiguous run of bytes and can be loaded into a single vector register
+struct HandBatch{
+    int hands = 0; //Number of hands in the batch
+    int stride = 0; //Hands rounded up to a multiple of BATCH_LANES. Padding hands have no cards
+    int maxCards = 0; //Most cards held by any hand in the batch
+    std::vector<uint8_t> cards; //Card bits, column by column
+    std::vector<uint8_t> counts; //Number of cards in each hand
+    
+    //Empties the batch and makes room for the given number of hands
+    void reset(int handCount);
+    
+    //Copies a hand into position i of the batch
+    void set(int i, const Hand& hand);
+};
+
+//Results of evaluating a batch: one byte per hand
+struct BatchResult{
+    std::vector<uint8_t> totals; //Best total of each hand
+    std::vector<uint8_t> soft; //1 if an ace is counted as 11
+    std::vector<uint8_t> bust; //1 if the hand totals over 21
+};
+
+//Which implementation evaluateHands uses. AUTO picks the fastest one the CPU supports when the program runs
+enum BatchKernel{
+    KERNEL_AUTO,
+    KERNEL_SCALAR,
+    KERNEL_SSE2,
+    KERNEL_AVX2
+};
+
+//Computes the total, soft flag and bust flag of every hand in the batch
+//Instead of lowering aces one at a time like the Hand class, every ace is counted as 1 and a single ace is raised to 11 if that doesn't bust, which is the same answer but needs no loop per hand
+//A kernel the CPU can't run is swapped for the widest one it can, as with KERNEL_AUTO
+void evaluateHands(const HandBatch& batch, BatchResult& result, BatchKernel kernel = KERNEL_AUTO);
+
+//Returns true if the given kernel can run on this CPU
+bool batchKernelSupported(BatchKernel kernel);
+
+#endif
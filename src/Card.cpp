@@ -0,0 +1,17 @@
+#include "Card.h"
+
+using namespace std;
+
+//Create deck function instantiates the deck (vector) using the suit and rank indexes
+vector<Card> createDeck(){
+    vector<Card> deck;//Initialize deck vector array empty, then will be added to through the for-loop
+    deck.reserve(SUIT_COUNT * RANK_COUNT); //Reserve room for all 52 cards up front
+    //Nested for-loop loops per suit, the size of the rank array (13) and would push back an element in the deck array with a card data type for the cards rank and its corresponding suit
+    for (int i = 0; i < SUIT_COUNT; i++) {
+        for (int j = 0; j < RANK_COUNT; j++) {
+            deck.push_back(Card(j, i));
+        }
+    }
+
+    return deck;
+}
@@ -0,0 +1,42 @@
+#ifndef CARD_H
+#define CARD_H
+
+#include <cstdint> //Fixed-width integer types used to pack a card into one byte
+#include <vector>
+
+//Card struct packs a card into a single byte: the low 4 bits hold the rank index (0 = "2" ... 12 = "Ace") and the next 2 bits hold the suit index
+//Keeping a card this small means copying it is as cheap as copying a char, and a whole hand fits in a few bytes instead of heap-backed strings
+struct Card{
+    uint8_t bits; //Packed rank and suit
+
+    Card(int r = 0, int s = 0) : bits((uint8_t)(r | (s << 4))) {} //Card constructor used when accessing cards directly in the createDeck function
+    int rank() const { return bits & 0x0F; } //Unpacks the rank index (0-12)
+    int suit() const { return bits >> 4; } //Unpacks the suit index (0-3)
+};
+
+const int SUIT_COUNT = 4; //Hearts, Diamonds, Clubs, Spades
+const int RANK_COUNT = 13; //2 through 10, Jack, Queen, King, Ace
+const int ACE = 12; //Rank index of the ace
+
+//Lookup table of the value each rank adds to a hand, indexed by the rank index. Aces start at 11 and are lowered to 1 by the hand total logic
+const int CARD_VALUES[RANK_COUNT] = {2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 11};
+
+//Cards can also be grouped by the value they add to a hand: value index 0 is a 2, index 7 is a 9, index 8 is every ten-value card (10, J, Q, K) and index 9 is an ace
+//Strategy tables and shoe compositions are indexed this way, since a 10 and a King always play the same
+const int VALUE_COUNT = 10;
+const int TEN_VALUE_INDEX = 8;
+const int ACE_VALUE_INDEX = 9;
+
+//Returns the value index of a card rank
+inline int valueIndex(int rank){
+    return CARD_VALUES[rank] - 2;
+}
+
+//Display names are only needed when a card is drawn on screen, so they live in tables used by the ASCII function
+const char* const RANK_NAMES[RANK_COUNT] = {"2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"};
+const char* const SUIT_SYMBOLS[SUIT_COUNT] = {"♥", "♦", "♣", "♠"};
+
+//Create deck function instantiates one 52-card deck (vector) using the suit and rank indexes
+std::vector<Card> createDeck();
+
+#endif
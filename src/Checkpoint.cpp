@@ -0,0 +1,181 @@
+#include "Checkpoint.h"
+#include "RoundLog.h" //Rule flags
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+//Where everything sits in the file follows from the header alone
+static size_t recordSize(const CheckpointHeader& header){
+    return sizeof(CheckpointRecord) + header.seats * sizeof(SeatScore);
+}
+
+static size_t recordsOffset(const CheckpointHeader& header){
+    return sizeof(CheckpointHeader) + header.players * CHECKPOINT_NAME_SIZE;
+}
+
+static size_t fileSize(const CheckpointHeader& header){
+    return recordsOffset(header) + (size_t)header.slots * 2 * recordSize(header);
+}
+
+CheckpointHeader makeCheckpointHeader(CheckpointKind kind, const SimulationConfig& config, int seats, int players, int slots){
+    CheckpointHeader header;
+    header.kind = kind;
+    header.slots = slots;
+    header.seats = seats;
+    header.players = players;
+    header.seed = config.seed;
+    header.rounds = config.rounds;
+    header.penetration = config.penetration;
+    header.decks = config.decks;
+    header.countSpread = config.countSpread;
+    header.rules = logRuleFlags(config);
+    return header;
+}
+
+void restoreSettings(const CheckpointHeader& header, SimulationConfig& config){
+    config.seed = header.seed;
+    config.rounds = header.rounds;
+    config.penetration = header.penetration;
+    config.decks = header.decks;
+    config.countSpread = header.countSpread;
+    config.aiNum = header.seats - header.players;
+    config.hitSoft17 = header.rules & LOG_HIT_SOFT_17;
+    config.sixToFive = header.rules & LOG_SIX_TO_FIVE;
+    config.canDouble = header.rules & LOG_CAN_DOUBLE;
+    config.canSplit = header.rules & LOG_CAN_SPLIT;
+}
+
+bool Checkpoint::map(){
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(mapped == MAP_FAILED){
+        return false;
+    }
+    base = (char*)mapped;
+    return true;
+}
+
+CheckpointRecord* Checkpoint::record(int slot, int copy) const{
+    return (CheckpointRecord*)(base + recordsOffset(header()) + ((size_t)slot * 2 + copy) * recordSize(header()));
+}
+
+CheckpointRecord* Checkpoint::latest(int slot) const{
+    CheckpointRecord* first = record(slot, 0);
+    CheckpointRecord* second = record(slot, 1);
+    uint64_t a = first->sequence.load(memory_order_acquire);
+    uint64_t b = second->sequence.load(memory_order_acquire);
+    if(a == 0 && b == 0){
+        return nullptr;
+    }
+    return a > b ? first : second;
+}
+
+bool Checkpoint::resume(const string& path, CheckpointKind kind){
+    close();
+    fd = ::open(path.c_str(), O_RDWR);
+    if(fd < 0){
+        return false;
+    }
+    struct stat info;
+    if(fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(CheckpointHeader)){
+        close();
+        return false;
+    }
+    size = info.st_size;
+    if(!map()){
+        close();
+        return false;
+    }
+    
+    //Takes the file as it is only if the header says it's a checkpoint of this kind and the file is exactly the size its header gives
+    const CheckpointHeader& h = header();
+    if(h.magic != CHECKPOINT_MAGIC || h.version != CHECKPOINT_VERSION || h.kind != kind || h.slots == 0 || fileSize(h) != size){
+        close();
+        return false;
+    }
+    written.assign(h.slots, 0);
+    for(uint32_t slot = 0; slot < h.slots; slot++){
+        CheckpointRecord* last = latest(slot);
+        if(last){
+            written[slot] = last->sequence.load(memory_order_relaxed);
+        }
+    }
+    return true;
+}
+
+bool Checkpoint::isFree(const string& path){
+    struct stat info;
+    return stat(path.c_str(), &info) != 0 || info.st_size == 0;
+}
+
+bool Checkpoint::create(const string& path, const CheckpointHeader& fresh, bool replace, const vector<string>& names){
+    close();
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | (replace ? O_TRUNC : 0), 0644);
+    if(fd < 0){
+        return false;
+    }
+    struct stat info;
+    if(fstat(fd, &info) != 0 || info.st_size != 0){ //Checked again on the open file, in case it was written since isFree looked
+        close();
+        return false;
+    }
+    size = fileSize(fresh);
+    if(ftruncate(fd, size) != 0 || !map()){ //The new file reads as zeros, so no slot has been written yet
+        close();
+        return false;
+    }
+    memcpy(base, &fresh, sizeof(CheckpointHeader));
+    for(uint32_t i = 0; i < fresh.players && i < names.size(); i++){
+        strncpy(base + sizeof(CheckpointHeader) + i * CHECKPOINT_NAME_SIZE, names[i].c_str(), CHECKPOINT_NAME_SIZE - 1);
+    }
+    written.assign(fresh.slots, 0);
+    return true;
+}
+
+void Checkpoint::close(){
+    if(base){
+        munmap(base, size);
+        base = nullptr;
+    }
+    if(fd >= 0){
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+string Checkpoint::name(int player) const{
+    const char* start = base + sizeof(CheckpointHeader) + player * CHECKPOINT_NAME_SIZE;
+    return string(start, strnlen(start, CHECKPOINT_NAME_SIZE));
+}
+
+void Checkpoint::save(int slot, const CheckpointProgress& progress, const SeatTable& table){
+    uint64_t number = ++written[slot];
+    CheckpointRecord* target = record(slot, number % 2); //The older copy; the newer one stays whole while this one is written
+    target->sequence.store(0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst); //Marked unfinished before any of it changes
+    target->progress = progress;
+    SeatScore* scores = (SeatScore*)(target + 1);
+    int seats = min((int)header().seats, table.size());
+    for(int i = 0; i < seats; i++){
+        scores[i] = table.getScore(i);
+    }
+    target->sequence.store(number, memory_order_release);
+}
+
+bool Checkpoint::load(int slot, CheckpointProgress& progress, SeatTable& table) const{
+    const CheckpointRecord* last = latest(slot);
+    if(!last){
+        return false;
+    }
+    progress = last->progress;
+    const SeatScore* scores = (const SeatScore*)(last + 1);
+    int seats = min((int)header().seats, table.size());
+    for(int i = 0; i < seats; i++){
+        table.setScore(i, scores[i]);
+    }
+    return true;
+}
@@ -0,0 +1,115 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "SeatTable.h"
+#include "Shoe.h"
+#include "Simulation.h"
+#include "Stats.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+const uint32_t CHECKPOINT_MAGIC = 0x4B433132; //"21CK" as the first four bytes of the file
+const uint32_t CHECKPOINT_VERSION = 1;
+const int CHECKPOINT_NAME_SIZE = 32; //Bytes kept of each player's name, the terminating zero included
+
+//What a checkpoint holds
+enum CheckpointKind : uint32_t{
+    CHECKPOINT_SIMULATION = 1,
+    CHECKPOINT_GAME = 2
+};
+
+//CheckpointHeader struct starts every checkpoint file: the kind of session, its shape, and the settings it was started with, so a resumed session plays on exactly as it began
+struct CheckpointHeader{
+    uint32_t magic = CHECKPOINT_MAGIC;
+    uint32_t version = CHECKPOINT_VERSION;
+    uint32_t kind = 0;
+    uint32_t slots = 0; //Progress records: one per simulation thread, one for a game
+    uint32_t seats = 0; //Seats with score counters: a simulation's AIs, or a game's players and then its AIs
+    uint32_t players = 0; //Human players of a game, whose names follow the header
+    uint64_t seed = 0;
+    int64_t rounds = 0; //Rounds of a simulation
+    double penetration = 0;
+    int32_t decks = 0;
+    int32_t countSpread = 0;
+    uint32_t rules = 0; //Rule flags, as stored in a round log
+    uint32_t unused = 0; //Keeps the header a whole number of 8-byte words
+};
+
+//CheckpointProgress struct is how far one slot has got: a simulation thread's next block and statistics, or a game's round count and shoe
+struct CheckpointProgress{
+    int64_t nextBlock = 0; //First block of the thread's range not yet played
+    int64_t rounds = 0; //Rounds the game has played, over every run of the session
+    ShoeState shoe; //Where the game's shoe is
+    RoundStats stats; //The thread's statistics
+};
+
+//CheckpointRecord struct is one of the two copies of a slot in the file, followed by the score of every seat. The copies are written in turn: a copy's number is cleared before it's rewritten and set once it's complete, so a crash in the middle of a write still leaves the other copy to resume from
+struct CheckpointRecord{
+    std::atomic<uint64_t> sequence; //Number of the write, 0 while it's being written or if it never was
+    CheckpointProgress progress;
+};
+
+//Builds the header of a new checkpoint for a session of the given shape
+CheckpointHeader makeCheckpointHeader(CheckpointKind kind, const SimulationConfig& config, int seats, int players, int slots);
+
+//Copies the settings a checkpoint was started with into config
+void restoreSettings(const CheckpointHeader& header, SimulationConfig& config);
+
+//Checkpoint class keeps a session's progress in a memory-mapped file of fixed layout: the header, the players' names, then two copies of every slot. Saving is a copy into the mapped memory with no system call and nothing to serialize, and the kernel writes the pages back on its own, so the file survives the process crashing or being killed. Resuming maps the file and reads the structs straight out of it
+//Every slot has a single writer, so threads can each save their own slot at once
+class Checkpoint{
+private:
+    int fd = -1;
+    char* base = nullptr;
+    size_t size = 0;
+    std::vector<uint64_t> written; //Number of the last write of each slot
+    
+    //Maps size bytes of the open file
+    bool map();
+    
+    CheckpointRecord* record(int slot, int copy) const;
+    
+    //Returns the copy of a slot that was written last, or nullptr if neither has been
+    CheckpointRecord* latest(int slot) const;
+public:
+    Checkpoint() {}
+    ~Checkpoint(){
+        close();
+    }
+    
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+    
+    //Maps an existing checkpoint of the given kind. Returns false if there's none at path, or the file isn't one
+    bool resume(const std::string& path, CheckpointKind kind);
+    
+    //Returns true if there's no file at path or it's empty, so a new checkpoint can start there without destroying anything
+    static bool isFree(const std::string& path);
+    
+    //Starts a new checkpoint at path with the given header and player names and no progress yet. Returns false if the file can't be created, or if it already has something in it and replace isn't set
+    bool create(const std::string& path, const CheckpointHeader& header, bool replace, const std::vector<std::string>& names = {});
+    
+    void close();
+    
+    bool isOpen() const{
+        return base != nullptr;
+    }
+    
+    const CheckpointHeader& header() const{
+        return *(const CheckpointHeader*)base;
+    }
+    
+    //Returns the name of a game's player
+    std::string name(int player) const;
+    
+    //Writes a slot's progress and the score of every seat in table
+    void save(int slot, const CheckpointProgress& progress, const SeatTable& table);
+    
+    //Reads the last progress saved in a slot and puts its scores into table. Returns false if the slot was never saved
+    bool load(int slot, CheckpointProgress& progress, SeatTable& table) const;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef DEALER_H
+#define DEALER_H
+
+#include "Hand.h"
+#include "Profile.h"
+#include "Shoe.h"
+#include "Renderer.h"
+
+//Dealer class
+class Dealer{
+private:
+    //Private member of the dealers hand, which keeps its own total
+    Hand hand;
+public:
+    //Passes through the shoe by reference so the card is dealt from the shared shoe, and not from a copy.
+    void addCard(Shoe& shoe){
+        hand.add(shoe.draw()); //Add one card to the hand from the top of the shoe
+    }
+    
+    //Returns the hand total, which the hand keeps up to date as cards are added
+    int calculateHT(){
+        PROFILE_COUNT(COUNT_CALCULATE_HT);
+        return hand.getTotal();
+    }
+    
+    //Get function that returns the dealers hand
+    const Hand& getHand(){
+        return hand;
+    }
+    
+    //Returns the dealers face-up card (the first card dealt)
+    Card getUpcard(){
+        return hand.card(0);
+    }
+    
+    //Returns the value of the hidden card once its the dealers 2nd turn
+    Card getHiddenCard(){
+        return hand.card(1);  //Second card is face down
+    }
+    
+    //Non-return type function that adds the dealers hand to the frame. Initializes a parameter revealAll, and on first run will be passed through as false to trigger the if-statement to only show the first card in hand, and the other card facedown
+    void printHand(Renderer& render, bool revealAll = true){
+        render.line("------------------");
+        //If statement checks if the dealer will reveal their card or not
+        if(!revealAll){
+            //Show only the first two cards, the second one face down
+            render.hand(hand, true);
+        }else{
+            //Shows the whole hand and the dealers hand total
+            render.hand(hand);
+            render.line("---");
+            render.line("Dealer total: " + std::to_string(calculateHT()));
+            render.line("---");
+        }
+    }
+    
+    //Passes through shoe by reference, and will automatically add a card to the hand until it's value totals 17 or more. With HitSoft17 the dealer also hits a soft 17
+    template<bool HitSoft17 = false>
+    void play(Shoe& shoe){
+        while (calculateHT() <= 16 || (HitSoft17 && calculateHT() == 17 && hand.isSoft())) {
+            addCard(shoe);
+        }
+    }
+    
+    //Same as above with the soft 17 rule picked at run time, for the interactive table
+    void play(Shoe& shoe, bool hitSoft17){
+        if(hitSoft17){
+            play<true>(shoe);
+        }else{
+            play<false>(shoe);
+        }
+    }
+    
+    //Returns true if the dealer was dealt a natural
+    bool hasBlackjack(){
+        return hand.isNatural();
+    }
+   
+    //Returns a true/false if the hand is totaled over 21, therefore the dealer will bust
+    bool checkBust(){
+        return hand.isBust();
+    }
+    
+    //Returns the dealers hand total
+    int getTotal(){
+        return hand.getTotal();
+    }
+    
+    void resetHand(){
+        hand.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,183 @@
+#include "DealerOdds.h"
+#include <algorithm>
+
+using namespace std;
+
+ShoeComposition ShoeComposition::fullShoe(int decks){
+    ShoeComposition shoe;
+    for(int rank = 0; rank < RANK_COUNT; rank++){
+        shoe.counts[valueIndex(rank)] += SUIT_COUNT * decks;
+    }
+    return shoe;
+}
+
+int ShoeComposition::total() const{
+    int n = 0;
+    for(int v = 0; v < VALUE_COUNT; v++){
+        n += counts[v];
+    }
+    return n;
+}
+
+//Value a card adds with aces counted as 1
+static int hardValue(int v){
+    return v == ACE_VALUE_INDEX ? 1 : v + 2;
+}
+
+//Best total of a hand given its total with aces as 1
+static int bestTotal(int hard, bool hasAce){
+    return hasAce && hard <= 11 ? hard + 10 : hard;
+}
+
+//Returns the value index of the hole card that would give the dealer a natural with this upcard, or -1 if none can
+static int naturalHole(int upcard){
+    return upcard == ACE_VALUE_INDEX ? TEN_VALUE_INDEX : upcard == TEN_VALUE_INDEX ? ACE_VALUE_INDEX : -1;
+}
+
+//Chance that the player's next card has value index v when the dealer's unseen hole card is still in the shoe but is known not to be of value excluded (the dealer peeked and has no natural)
+//The hole card and the player's card are two different cards of the shoe, so a value the hole can't be becomes a little more likely for the player, and the chances still add up to 1
+static double drawChance(const ShoeComposition& shoe, int v, int excluded, int cardsLeft){
+    if(excluded < 0){
+        return (double)shoe.counts[v] / cardsLeft;
+    }
+    int allowed = cardsLeft - shoe.counts[excluded]; //Cards the hole card can be
+    if(allowed <= 0 || cardsLeft <= 1){
+        return 0;
+    }
+    return (double)shoe.counts[v] * (cardsLeft - 1 - shoe.counts[excluded] + (v == excluded)) / ((double)(cardsLeft - 1) * allowed);
+}
+
+//Packs the counts into one 64-bit word: 6 bits for each of the nine non-ten values (at most 32 with 8 decks) and 8 bits for the ten-values (at most 128)
+uint64_t DealerOdds::packComposition(const ShoeComposition& shoe){
+    uint64_t packed = 0;
+    for(int v = 0; v < VALUE_COUNT; v++){
+        packed = (packed << (v == TEN_VALUE_INDEX ? 8 : 6)) | shoe.counts[v];
+    }
+    return packed;
+}
+
+DealerDistribution DealerOdds::dealerFrom(ShoeComposition& shoe, int hard, bool hasAce){
+    DealerDistribution dist = {};
+    int total = bestTotal(hard, hasAce);
+    bool soft = hasAce && hard <= 11;
+    
+    //The dealer stops on 17 or more (hitting a soft 17 only when the rules say so)
+    if(total > 21){
+        dist[FINAL_BUST] = 1;
+        return dist;
+    }
+    if(total >= 17 && !(hitSoft17 && soft && total == 17)){
+        dist[FINAL_17 + total - 17] = 1;
+        return dist;
+    }
+    
+    Key key = {packComposition(shoe), (uint32_t)(hard << 1 | hasAce)};
+    auto found = dealerMemo.find(key);
+    if(found != dealerMemo.end()){
+        return found->second;
+    }
+    
+    //Draws each value still in the shoe with its probability. If the shoe is empty the dealer can't finish the hand and the distribution stays all zero
+    int cardsLeft = shoe.total();
+    for(int v = 0; v < VALUE_COUNT; v++){
+        if(shoe.counts[v] == 0){
+            continue;
+        }
+        double p = (double)shoe.counts[v] / cardsLeft;
+        shoe.counts[v]--;
+        DealerDistribution next = dealerFrom(shoe, hard + hardValue(v), hasAce || v == ACE_VALUE_INDEX);
+        shoe.counts[v]++;
+        for(int f = 0; f < FINAL_COUNT; f++){
+            dist[f] += p * next[f];
+        }
+    }
+    
+    dealerMemo[key] = dist;
+    return dist;
+}
+
+DealerDistribution DealerOdds::dealerOutcomes(int upcard, const ShoeComposition& shoe, bool peeked){
+    ShoeComposition remaining = shoe;
+    int excluded = peeked ? naturalHole(upcard) : -1;
+    if(excluded < 0){
+        return dealerFrom(remaining, hardValue(upcard), upcard == ACE_VALUE_INDEX);
+    }
+    
+    //Draws the hole card from every value but the one that makes a natural, renormalised over the cards it can be
+    DealerDistribution dist = {};
+    int allowed = remaining.total() - remaining.counts[excluded];
+    for(int v = 0; v < VALUE_COUNT; v++){
+        if(v == excluded || remaining.counts[v] == 0){
+            continue;
+        }
+        double p = (double)remaining.counts[v] / allowed;
+        remaining.counts[v]--;
+        DealerDistribution next = dealerFrom(remaining, hardValue(upcard) + hardValue(v), upcard == ACE_VALUE_INDEX || v == ACE_VALUE_INDEX);
+        remaining.counts[v]++;
+        for(int f = 0; f < FINAL_COUNT; f++){
+            dist[f] += p * next[f];
+        }
+    }
+    return dist;
+}
+
+//Expected value of standing on a total against a dealer distribution
+static double standEV(int total, const DealerDistribution& dealer){
+    if(total > 21){
+        return -1;
+    }
+    double ev = dealer[FINAL_BUST];
+    for(int f = FINAL_17; f <= FINAL_21; f++){
+        int dealerTotal = 17 + f;
+        ev += total > dealerTotal ? dealer[f] : total < dealerTotal ? -dealer[f] : 0;
+    }
+    return ev;
+}
+
+double DealerOdds::bestPlayerEV(ShoeComposition& shoe, int hard, bool hasAce, int upcard){
+    int total = bestTotal(hard, hasAce);
+    if(total > 21){
+        return -1;
+    }
+    
+    Key key = {packComposition(shoe), (uint32_t)(upcard << 6 | hard << 1 | hasAce)};
+    auto found = playerMemo.find(key);
+    if(found != playerMemo.end()){
+        return found->second;
+    }
+    
+    double stand = standEV(total, dealerOutcomes(upcard, shoe, true));
+    double hit = 0;
+    int cardsLeft = shoe.total();
+    for(int v = 0; v < VALUE_COUNT; v++){
+        if(shoe.counts[v] == 0){
+            continue;
+        }
+        double p = drawChance(shoe, v, naturalHole(upcard), cardsLeft);
+        shoe.counts[v]--;
+        hit += p * bestPlayerEV(shoe, hard + hardValue(v), hasAce || v == ACE_VALUE_INDEX, upcard);
+        shoe.counts[v]++;
+    }
+    double best = total == 21 || cardsLeft == 0 ? stand : max(stand, hit);
+    
+    playerMemo[key] = best;
+    return best;
+}
+
+DecisionEV DealerOdds::decisionEV(int playerHard, bool playerHasAce, int upcard, const ShoeComposition& shoe){
+    ShoeComposition remaining = shoe;
+    DecisionEV ev;
+    ev.stand = standEV(bestTotal(playerHard, playerHasAce), dealerOutcomes(upcard, remaining, true));
+    ev.hit = 0;
+    int cardsLeft = remaining.total();
+    for(int v = 0; v < VALUE_COUNT; v++){
+        if(remaining.counts[v] == 0){
+            continue;
+        }
+        double p = drawChance(remaining, v, naturalHole(upcard), cardsLeft);
+        remaining.counts[v]--;
+        ev.hit += p * bestPlayerEV(remaining, playerHard + hardValue(v), playerHasAce || v == ACE_VALUE_INDEX, upcard);
+        remaining.counts[v]++;
+    }
+    return ev;
+}
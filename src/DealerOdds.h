@@ -0,0 +1,101 @@
+#ifndef DEALERODDS_H
+#define DEALERODDS_H
+
+#include "Card.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+//ShoeComposition counts the cards of each value still left in the shoe
+struct ShoeComposition{
+    uint8_t counts[VALUE_COUNT] = {};
+    
+    //Composition of a freshly shuffled shoe
+    static ShoeComposition fullShoe(int decks);
+    
+    //Takes one card out (when it is dealt) or puts it back
+    void remove(Card card){
+        counts[valueIndex(card.rank())]--;
+    }
+    
+    void add(Card card){
+        counts[valueIndex(card.rank())]++;
+    }
+    
+    //Returns the number of cards left
+    int total() const;
+};
+
+//Where the dealer's hand finishes
+enum DealerFinal{
+    FINAL_17,
+    FINAL_18,
+    FINAL_19,
+    FINAL_20,
+    FINAL_21,
+    FINAL_BUST,
+    FINAL_COUNT
+};
+
+//Probability of each DealerFinal
+typedef std::array<double, FINAL_COUNT> DealerDistribution;
+
+//Expected value of each choice a player can make, in bets won (+1) or lost (-1)
+struct DecisionEV{
+    double stand;
+    double hit; //Hit now, then keep hitting or standing, whichever is better at each step
+};
+
+//DealerOdds computes exact probabilities instead of sampling: given the dealer's upcard and the cards left in the shoe, it walks every way the dealer's hand can finish
+//Every intermediate result is remembered, keyed on the shoe composition and the dealer's hand, so repeated and overlapping queries (the same upcard and shoe, or the shoe a few cards later) are mostly table lookups
+//Not thread-safe: each thread should use its own DealerOdds
+class DealerOdds{
+private:
+    bool hitSoft17; //True if the dealer hits a soft 17 (the game's dealer stands on every 17)
+    
+    //Key of a remembered result: the packed composition and the packed hand state
+    struct Key{
+        uint64_t composition;
+        uint32_t state;
+        bool operator==(const Key& other) const{
+            return composition == other.composition && state == other.state;
+        }
+    };
+    
+    struct KeyHash{
+        size_t operator()(const Key& key) const{
+            return key.composition * 0x9E3779B97F4A7C15ULL ^ key.state;
+        }
+    };
+    
+    std::unordered_map<Key, DealerDistribution, KeyHash> dealerMemo;
+    std::unordered_map<Key, double, KeyHash> playerMemo;
+    
+    static uint64_t packComposition(const ShoeComposition& shoe);
+    DealerDistribution dealerFrom(ShoeComposition& shoe, int hard, bool hasAce);
+    double bestPlayerEV(ShoeComposition& shoe, int hard, bool hasAce, int upcard);
+public:
+    DealerOdds(bool dealerHitsSoft17 = false) : hitSoft17(dealerHitsSoft17) {}
+    
+    //Distribution of the dealer's final total given the upcard's value index and the cards left in the shoe (the upcard already taken out). The hole card is drawn from the same shoe
+    //With peeked, the dealer is known not to have a natural, as when the players get to act: a hole card that would make one is left out of the first draw and the rest renormalised
+    DealerDistribution dealerOutcomes(int upcard, const ShoeComposition& shoe, bool peeked = false);
+    
+    //Exact expected value of standing and of hitting for a player hand, described by its total with aces counted as 1 and whether it holds an ace
+    //The shoe is the cards left after the player's cards and the dealer's upcard were dealt, with the hole card still in it. Players only act once the dealer has peeked, so the dealer is known not to have a natural
+    DecisionEV decisionEV(int playerHard, bool playerHasAce, int upcard, const ShoeComposition& shoe);
+    
+    //Number of remembered results
+    size_t memoSize() const{
+        return dealerMemo.size() + playerMemo.size();
+    }
+    
+    //Forgets every remembered result
+    void clear(){
+        dealerMemo.clear();
+        playerMemo.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,315 @@
+#include "Game.h"
+#include "AI.h"
+#include "Checkpoint.h"
+#include "Dealer.h"
+#include "Player.h"
+#include "Profile.h"
+#include "RoundLog.h"
+#include "SeatTable.h"
+#include "Shoe.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+void playGame(const SimulationConfig& requested, Renderer& render, Input& input){
+    SimulationConfig config = requested;
+    vector<Player> players; //Initializes a vector player object for each player
+    int playerNum; //Integer playrnum to take in user inputted how many players will be playing
+    int aiNum; //Int aiNum for however many ais are to be added
+    render.line(R"(
+     _____  __    _____                      
+    / __  \/  |  |  __ \                     
+    `' / /'`| |  | |  \/ __ _ _ __ ___   ___ 
+      / /   | |  | | __ / _` | '_ ` _ \ / _ \
+    ./ /____| |_ | |_\ \ (_| | | | | | |  __/
+    \_____/\___/  \____/\__,_|_| |_| |_|\___|
+    )");
+    
+    //A checkpoint left by an earlier run picks the session up where it stopped: the same players and AIs, their scores, and the shoe dealt from where it was. Otherwise the players are asked for, unless the file is something else that would be overwritten
+    Checkpoint checkpoint;
+    bool resumed = !config.checkpointPath.empty() && !config.overwriteCheckpoint && checkpoint.resume(config.checkpointPath, CHECKPOINT_GAME);
+    if(!resumed && !config.checkpointPath.empty() && !config.overwriteCheckpoint && !Checkpoint::isFree(config.checkpointPath)){
+        render.result(config.checkpointPath + " isn't a checkpoint of a game. Not overwriting it without --overwrite-checkpoint");
+        render.flush();
+        return;
+    }
+    if(resumed){
+        restoreSettings(checkpoint.header(), config);
+        playerNum = checkpoint.header().players;
+        aiNum = config.aiNum;
+        for(int i = 0; i < playerNum; i++){
+            players.push_back(Player(checkpoint.name(i)));
+        }
+    }else{
+        render.prompt("Enter number of players: ");
+        playerNum = input.number(0);
+        
+        //Iterates through each player and takes in their name
+        for(int i = 0; i < playerNum; i++){
+            string pName;
+            render.prompt("Enter name of Player " + to_string(i + 1) + ": ");
+            pName = input.word("Player" + to_string(i + 1));
+            players.push_back(Player(pName));
+        }
+        
+        render.prompt("Would you like to add AI players? If so, how many? (Type 0 if no AIs are wanted): ");
+        aiNum = input.number(0);
+    }
+    vector<AI> bot(aiNum); //Initializes the array with the # element value of aiNum integer, every AI playing basic strategy
+    
+    Shoe shoe(config.decks, config.penetration, config.seed); //The shoe stays on the table between rounds and is reshuffled once the cut card comes out
+    Dealer dealer; //The dealer, like the players and AIs, is created once and has its hand cleared every round
+    SeatTable table(playerNum + aiNum); //Every seat's round result and score counters
+    
+    //The checkpoint is saved after every round: the scores, the shoe, and the rounds played over the whole session
+    CheckpointProgress progress;
+    if(resumed){
+        if(checkpoint.load(0, progress, table)){
+            shoe.resume(progress.shoe);
+        }
+        render.line("Resuming the session in " + config.checkpointPath + " after " + to_string(progress.rounds) + " rounds");
+    }else if(!config.checkpointPath.empty()){
+        vector<string> names;
+        for(int i = 0; i < playerNum; i++){
+            names.push_back(players[i].getName());
+        }
+        if(!checkpoint.create(config.checkpointPath, makeCheckpointHeader(CHECKPOINT_GAME, config, playerNum + aiNum, playerNum, 1), config.overwriteCheckpoint, names)){
+            render.result("Can't checkpoint to " + config.checkpointPath);
+            render.flush();
+            return;
+        }
+    }
+    
+    //Every round is appended to the round log if there is one. The log starts with the seed, so the replay tool can deal the same shoe again. The table only offers hit or stand, so doubling and splitting are left out of its rules
+    LogFile logFile;
+    RoundLog log(&logFile);
+    bool logging = false;
+    if(!config.logPath.empty()){
+        logging = playerNum + aiNum <= MAX_LOG_SEATS && logFile.open(config.logPath);
+        if(logging){
+            log.table(config.seed, config.decks, playerNum + aiNum, logRuleFlags(config) & (LOG_HIT_SOFT_17 | LOG_SIX_TO_FIVE));
+        }else{
+            render.line("Can't log to " + config.logPath);
+        }
+    }
+    
+    char choice;
+    long long roundsPlayed = 0;
+    do{
+        PROFILE_ROUND(timer); //Times each phase of the round when built with profiling
+        
+        //Reshuffles the shoe before the round if the cut card came out last round
+        if(checkDeckSize(shoe)){
+            render.line("----Cut card reached. Reshuffling the shoe.----");
+            if(logging){
+                log.shuffle();
+            }
+        }
+        PROFILE_LAP(timer, PHASE_SHUFFLE);
+        
+        //Resets the players hand each iteration of a new round
+        for(int i = 0; i < playerNum; i++){
+            players[i].resetHand();
+        }
+        
+        //Iterates through each player and adds 2 initial cards to their hand
+        for(int i = 0; i < playerNum; i++){
+            players[i].addCard(shoe);
+            players[i].addCard(shoe);
+            
+        }
+        //Resets the AI's hand each iteration of a new round
+        for(int i = 0; i < aiNum; i++){
+            bot[i].resetHand();
+        }
+        
+        //Iterates through each ai and adds 2 initial cards to their hand
+        for(int i = 0; i < aiNum; i++){
+            bot[i].addCard(shoe);
+            bot[i].addCard(shoe);
+        }
+        
+        //Add two cards to the dealer, and then tell the dealer to play
+        //Makes sure the dealers hand is cleared from the previous round
+        dealer.resetHand();
+        dealer.addCard(shoe);
+        dealer.addCard(shoe);
+        bool dealerNatural = dealer.hasBlackjack(); //The dealer checks for a natural before anyone plays
+        PROFILE_LAP(timer, PHASE_DEAL);
+        dealer.play(shoe, config.hitSoft17);
+        PROFILE_LAP(timer, PHASE_DEALER);
+        
+        
+        //First turn, print the dealers hand but pass through a false bool to trigger the if-statement such that it outputs one card face-up and another face-down
+        render.line("--------------------");
+        render.line("Dealers hand: ");
+        dealer.printHand(render, false);
+        render.line("");
+        if(dealerNatural){
+            render.line("Dealer has blackjack!");
+        }
+        
+        //Turn-based system that iterates through all players until they all stay/bust. Nobody plays against a dealer natural
+        for(int i = 0; i < playerNum && !dealerNatural; i++){
+            Player &p = players[i]; //Initialize player object for each iteration, for a new player to access the player class
+            
+            while(true){//Always be true (loop infinetly), will break once the player busts/stays
+                if(p.checkBust()){//Check if the player has busted (their hand total is > 21
+                    render.line(p.getName() + " Busted"); //Output player Name and that they've busted
+                    break; //Break out of while-loop to end this players turn
+                    
+                }
+                
+                //Print players hand
+                render.line("--------------------");
+                render.line(p.getName() + "'s Hand:");
+                p.printHand(render);
+                render.line("Total: " + to_string(p.calculateHT()));
+                
+                //Prompt user to hit/stay, which also writes out the frame built so far
+                render.prompt("Hit or Stay? (h/s): ");
+                char choice = input.choice('s'); //Stays once the script runs out
+                
+                //Makes sure the user input is valid
+                while (choice != 'h' && choice != 's' && choice != 'H' && choice != 'S') {
+                    render.prompt("Invalid choice, please enter h or s\n");
+                    choice = input.choice('s');
+                }
+                
+                //Checks whether player has hit, or stayed
+                if(choice == 'h'){
+                    p.addCard(shoe); //Add a card to the players hand
+                    render.line("--------------------");
+                    render.line(p.getName() + "'s hand:");
+                    p.printHand(render); //Print the players hand
+                    render.line("New total: " + to_string(p.calculateHT()));
+                }else{
+                    //Player choses to stay, show final total and end their turn
+                    render.line(p.getName() + " stays with their total: " + to_string(p.calculateHT()));
+                    break;
+                }
+            }
+        }
+        PROFILE_LAP(timer, PHASE_PLAYERS);
+        
+        //Iterates through each AI and prints their hand and total
+        for(int i = 0; i < aiNum; i++){
+            render.line("--------------------");
+            render.line("AI " + to_string(i + 1) + "'s Hand:");
+            if(!dealerNatural){
+                bot[i].play<HitStandRules>(shoe, dealer.getUpcard());
+            }
+            bot[i].printHand(render);
+            render.line("AI " + to_string(i + 1) + " Total: " + to_string(bot[i].calculateHT()));
+        }
+        PROFILE_LAP(timer, PHASE_AI);
+        
+        //Dealer reveals their full hand, and will keep playing until HT > 17
+        render.line("");
+        render.line("Dealer reveals face-down card:");
+        dealer.printHand(render, true);
+        
+        //Records every players and ai's hand in the seat table (players first, then AIs) and settles the whole table against the dealer in one pass
+        for(int i = 0; i < playerNum; i++){
+            table.record(i, players[i].getHand());
+        }
+        for(int i = 0; i < aiNum; i++){
+            table.record(playerNum + i, bot[i].getHand());
+        }
+        table.settle(dealer.getTotal(), dealerNatural, config.sixToFive ? PAY_6_TO_5 : PAY_3_TO_2);
+        
+        //Logs the round in the order the cards came out of the shoe (opening cards, the dealers hits, then every seats turn) and writes it out, so the log is complete up to the last round played. If the write fails the game goes on without the log
+        if(logging){
+            log.round();
+            for(int i = 0; i < playerNum; i++){
+                log.opening(i, players[i].getHand().card(0), players[i].getHand().card(1));
+            }
+            for(int i = 0; i < aiNum; i++){
+                log.opening(playerNum + i, bot[i].getHand().card(0), bot[i].getHand().card(1));
+            }
+            log.opening(DEALER_SEAT, dealer.getHand().card(0), dealer.getHand().card(1));
+            log.dealerTurn(dealer.getHand());
+            if(!dealerNatural){
+                for(int i = 0; i < playerNum; i++){
+                    log.turn(i, players[i].getHand(), false);
+                }
+                for(int i = 0; i < aiNum; i++){
+                    log.turn(playerNum + i, bot[i].getHand(), false);
+                }
+            }
+            for(int seat = 0; seat < playerNum + aiNum; seat++){
+                log.result(seat, table.getResult(seat), table.getPayout(seat));
+            }
+            if(!log.flush()){
+                render.result("Can't write to " + config.logPath + ", so the log stops at the last round written");
+                logging = false;
+            }
+        }
+        
+        //Iterates through each player and reports how their hand did against the dealers
+        for(int i = 0; i < playerNum; i++){
+            Player& p = players[i];
+            
+            if(table.isBust(i)){ //Checks if the player busted
+                render.result(p.getName() + " busted. Dealer wins.");
+            }else if(dealer.checkBust()){ //Checks if the dealer busted
+                render.result("The dealer has busted. " + p.getName() + " won!");
+            }else if(table.getResult(i) < 0){ //Dealer total is greater than a players total
+                render.result(p.getName() + "'s hand is less than the dealers. Dealer wins.");
+            }else if(table.getResult(i) > 0){ //Player total is greater than the dealer total
+                render.result(p.getName() + " wins!");
+            }else{//Player and dealer tie
+                render.result("The dealer ties with " + p.getName() + ". ");
+            }
+        }
+        
+        //Same messages as the player, but for the ais
+        for(int i = 0; i < aiNum; i++){
+            int seat = playerNum + i;
+            
+            if(table.isBust(seat)){ //Checks if the ai busted
+                render.result("AI " + to_string(i + 1) + " busted. Dealer wins.");
+            }else if(dealer.checkBust()){ //Checks if the dealer busted
+                render.result("The dealer has busted. AI " + to_string(i + 1) + " won!");
+            }else if(table.getResult(seat) < 0){ //Dealer total is greater than a ai total
+                render.result("Dealer wins.");
+            }else if(table.getResult(seat) > 0){ //ai total is greater than the dealer total
+                render.result("AI " + to_string(i + 1) + " wins!");
+            }else{//ai and dealer tie
+                render.result("The dealer ties with AI " + to_string(i + 1) + ". ");
+            }
+        }
+        PROFILE_LAP(timer, PHASE_SETTLE);
+        PROFILE_FINISH(timer);
+        
+        if(checkpoint.isOpen()){
+            progress.rounds++;
+            progress.shoe = shoe.getState();
+            checkpoint.save(0, progress, table);
+        }
+        
+        //Stops once the set number of rounds has been played, otherwise prompts the user if they'd like to play another game
+        roundsPlayed++;
+        if(config.gameRounds > 0){
+            choice = roundsPlayed < config.gameRounds ? 'y' : 'n';
+        }else{
+            render.prompt("Would you like to keep playing (y)? Otherwise, enter any key to exit: ");
+            choice = input.choice('n');
+        }
+    }while(choice == 'y' || choice == 'Y');
+    
+    //Use player and ai vectors and iterate through each players/ai final scores
+    for(int i = 0; i < playerNum; i++){
+        render.result("--------------------");
+        render.result(players[i].getName() + " Stats: ");
+        table.printScores(render, i);
+    }
+    
+    for(int i = 0; i < aiNum; i++){
+        render.result("--------------------");
+        render.result("AI " + to_string(i + 1) + " Stats:");
+        table.printScores(render, playerNum + i);
+    }
+    render.flush();
+}
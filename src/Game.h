@@ -0,0 +1,11 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "Input.h"
+#include "Renderer.h"
+#include "Simulation.h"
+
+//Plays the interactive game: asks for the players and AI seats, plays rounds until the players stop (or config.gameRounds rounds have been played), then prints the final scores. Every answer is read from input and everything shown goes through render
+void playGame(const SimulationConfig& config, Renderer& render, Input& input);
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef HAND_H
+#define HAND_H
+
+#include "Card.h"
+
+//Most cards a hand can ever hold: 21 aces (only possible with 6 or more decks) plus the card that busts it. A seat can't be dealt another card once it has busted
+const int MAX_HAND_SIZE = 22;
+
+//Hand class holds the cards dealt to a seat and keeps its total up to date as each card is added, so reading the total or checking for a bust never rescans the hand. Shared by the Dealer, Player and AI classes
+//The cards are stored inside the object in a fixed-size array, so dealing and clearing a hand never touches the heap
+class Hand{
+private:
+    Card cards[MAX_HAND_SIZE]; //Cards in the order they were dealt
+    uint8_t count = 0; //Number of cards in the hand
+    uint8_t softAces = 0; //Number of aces still counted as 11 in the total
+    int total = 0; //Best total of the hand, counting aces as 11 while that doesn't bust
+public:
+    //Adds a card and updates the total using the CARD_VALUES lookup table
+    void add(Card card){
+        cards[count++] = card;
+        total += CARD_VALUES[card.rank()];
+        softAces += card.rank() == ACE;
+        //If the new card busts the hand, aces counted as 11 are lowered to 1. A single card can only ever need this twice (an ace added to a soft 21)
+        while(total > 21 && softAces > 0){
+            total -= 10;
+            softAces--;
+        }
+    }
+    
+    //Returns the hand total
+    int getTotal() const{
+        return total;
+    }
+    
+    //Returns true if an ace is still being counted as 11
+    bool isSoft() const{
+        return softAces > 0;
+    }
+    
+    //Returns true if the hand totals over 21
+    bool isBust() const{
+        return total > 21;
+    }
+    
+    //Returns true for a natural: 21 on the first two cards
+    bool isNatural() const{
+        return count == 2 && total == 21;
+    }
+    
+    //Returns the number of cards in the hand
+    int size() const{
+        return count;
+    }
+    
+    //Returns the card at the given position
+    Card card(int i) const{
+        return cards[i];
+    }
+    
+    //Empties the hand for a new round
+    void clear(){
+        count = 0;
+        total = 0;
+        softAces = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "Input.h"
+#include <cctype>
+#include <cstdlib>
+
+using namespace std;
+
+bool Input::fill(){
+    if(ended){
+        return false;
+    }
+    buffer.erase(0, pos);
+    pos = 0;
+    
+    if(scripted){
+        size_t used = buffer.size();
+        buffer.resize(used + INPUT_CHUNK);
+        in->read(&buffer[used], INPUT_CHUNK);
+        buffer.resize(used + in->gcount());
+        if(in->gcount() == 0){
+            ended = true;
+            return false;
+        }
+        return true;
+    }
+    
+    string lineText;
+    if(!getline(*in, lineText)){
+        ended = true;
+        return false;
+    }
+    buffer += lineText;
+    buffer += '\n';
+    return true;
+}
+
+bool Input::next(){
+    //Skips the whitespace before the token, reading more text when the buffer runs out
+    while(true){
+        while(pos < buffer.size() && isspace((unsigned char)buffer[pos])){
+            pos++;
+        }
+        if(pos < buffer.size()){
+            break;
+        }
+        if(!fill()){
+            return false;
+        }
+    }
+    
+    //Finds the end of the token. A token cut off by the end of a block is finished by the next block
+    size_t end = pos;
+    while(true){
+        while(end < buffer.size() && !isspace((unsigned char)buffer[end])){
+            end++;
+        }
+        if(end < buffer.size() || ended){
+            break;
+        }
+        size_t offset = end - pos;
+        if(!fill()){
+            break;
+        }
+        end = pos + offset;
+    }
+    
+    token.assign(buffer, pos, end - pos);
+    pos = end;
+    return true;
+}
+
+const string& Input::word(const string& fallback){
+    if(!next()){
+        token = fallback;
+    }
+    return token;
+}
+
+int Input::number(int fallback){
+    if(!next()){
+        return fallback;
+    }
+    char* end;
+    long value = strtol(token.c_str(), &end, 10);
+    return *end == '\0' ? (int)value : fallback;
+}
+
+char Input::choice(char fallback){
+    if(!next()){
+        return fallback;
+    }
+    return token[0];
+}
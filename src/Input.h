@@ -0,0 +1,41 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <cstddef>
+#include <istream>
+#include <string>
+
+//Size of each block read from a script
+const size_t INPUT_CHUNK = 64 * 1024;
+
+//Input class hands the game its answers one whitespace-separated token at a time, from the keyboard or from a decision script (a file or a pipe)
+//A script is read in large blocks and split into tokens straight out of the buffer, so a long script never costs one read per answer. The keyboard is read a line at a time so every answer is used as soon as enter is pressed
+//Once the input runs out, every read returns the fallback answer it was given, so a script that ends early finishes the game instead of leaving it waiting
+class Input{
+private:
+    std::istream* in;
+    bool scripted; //Read in blocks (script) or by line (keyboard)
+    std::string buffer; //Text read but not yet used
+    size_t pos = 0; //Start of the next unread token in the buffer
+    bool ended = false; //The stream has no more text
+    std::string token; //Last token read. Keeps its memory between reads
+    
+    //Reads more text into the buffer, dropping the part already used. Returns false once the stream has nothing left
+    bool fill();
+    
+    //Moves the next token into token. Returns false if the input has run out
+    bool next();
+public:
+    Input(std::istream& stream, bool script) : in(&stream), scripted(script) {}
+    
+    //Returns the next token as a word, or fallback once the input has run out
+    const std::string& word(const std::string& fallback);
+    
+    //Returns the next token as a number, or fallback once the input has run out or if the token isn't a number
+    int number(int fallback);
+    
+    //Returns the first character of the next token, or fallback once the input has run out
+    char choice(char fallback);
+};
+
+#endif
@@ -0,0 +1,214 @@
+#include "Optimizer.h"
+#include "Stats.h"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+//First value index of every upcard group, and one past the last
+static const int GROUP_START[UPCARD_GROUPS + 1] = {0, 2, 5, VALUE_COUNT};
+static const char* const GROUP_NAMES[UPCARD_GROUPS] = {"2-3", "4-6", "7-A"};
+
+//Candidate struct is one strategy in the search and the net result of every block it has played so far
+struct Candidate{
+    StrategyParams params;
+    StrategyTable table;
+    vector<int64_t> blockNet; //Net of each block in tenths of a bet, summed over the seats
+    
+    //Net over every block played, to rank candidates that have played the same blocks
+    int64_t total() const{
+        int64_t sum = 0;
+        for(int64_t net : blockNet){
+            sum += net;
+        }
+        return sum;
+    }
+};
+
+//One task of a stage: a candidate plays blocks [firstBlock, endBlock)
+struct StageTask{
+    Candidate* candidate;
+    long long firstBlock;
+    long long endBlock;
+};
+
+static string describe(const StrategyParams& params){
+    string text = "stand on hard ";
+    for(int g = 0; g < UPCARD_GROUPS; g++){
+        text += to_string(params.hardStand[GROUP_START[g]]) + "+ vs " + GROUP_NAMES[g] + ", ";
+    }
+    return text + "soft " + to_string(params.softStand) + "+";
+}
+
+//Builds every combination of thresholds
+static vector<Candidate> makeCandidates(){
+    vector<Candidate> candidates;
+    const int hardChoices = MAX_HARD_STAND - MIN_HARD_STAND + 1;
+    int combinations = 1;
+    for(int g = 0; g < UPCARD_GROUPS; g++){
+        combinations *= hardChoices;
+    }
+    for(int soft = MIN_SOFT_STAND; soft <= MAX_SOFT_STAND; soft++){
+        for(int c = 0; c < combinations; c++){
+            Candidate candidate;
+            int rest = c;
+            for(int g = 0; g < UPCARD_GROUPS; g++){
+                for(int up = GROUP_START[g]; up < GROUP_START[g + 1]; up++){
+                    candidate.params.hardStand[up] = (int8_t)(MIN_HARD_STAND + rest % hardChoices);
+                }
+                rest /= hardChoices;
+            }
+            candidate.params.softStand = (int8_t)soft;
+            candidate.table = makeStrategy(candidate.params);
+            candidates.push_back(candidate);
+        }
+    }
+    return candidates;
+}
+
+//Plays one task with its own shoe, dealer, AI seats and seat table, and stores each block's net
+template<class R>
+static void playTask(const SimulationConfig& config, const StageTask& task){
+    Shoe shoe(config.decks, config.penetration, config.seed);
+    Dealer dealer;
+    vector<AI> bot(config.aiNum, AI(task.candidate->table));
+    SeatTable table(config.aiNum);
+    
+    int64_t counted = 0; //Net of the blocks before this one
+    for(long long block = task.firstBlock; block < task.endBlock; block++){
+        for(long long r = 0; r < ROUNDS_PER_BLOCK; r++){
+            shoe.startRound(config.seed, block, r); //The same cards for every candidate
+            playHeadlessRound<R, false>(shoe, dealer, bot, table);
+        }
+        int64_t net = 0;
+        for(int i = 0; i < config.aiNum; i++){
+            net += table.getNet(i);
+        }
+        task.candidate->blockNet[block] = net - counted;
+        counted = net;
+    }
+}
+
+//Has every candidate in players play blocks [firstBlock, endBlock). A candidate's blocks are cut into several tasks when there are too few candidates to keep every thread busy; each task writes only its own blocks, so no result is shared
+template<class R>
+static void runStage(const SimulationConfig& config, const vector<Candidate*>& players, long long firstBlock, long long endBlock){
+    long long blocks = endBlock - firstBlock;
+    long long chunks = ((long long)config.threadNum * TASKS_PER_THREAD + players.size() - 1) / players.size();
+    chunks = max(1LL, min(chunks, blocks));
+    
+    vector<StageTask> tasks;
+    for(Candidate* candidate : players){
+        candidate->blockNet.resize(endBlock);
+        for(long long c = 0; c < chunks; c++){
+            tasks.push_back({candidate, firstBlock + blocks * c / chunks, firstBlock + blocks * (c + 1) / chunks});
+        }
+    }
+    
+    //Each thread takes the next task until there are none left
+    atomic<size_t> next{0};
+    int threadNum = min((size_t)config.threadNum, tasks.size());
+    vector<thread> workers;
+    for(int t = 0; t < threadNum; t++){
+        workers.push_back(thread([&]{
+            for(size_t i = next++; i < tasks.size(); i = next++){
+                playTask<R>(config, tasks[i]);
+            }
+        }));
+    }
+    for(thread& worker : workers){
+        worker.join();
+    }
+}
+
+//Net per round per seat over the candidate's blocks, with its 95% interval, in bets
+static Welford netPerRound(const SimulationConfig& config, const Candidate& candidate){
+    double scale = (double)ROUNDS_PER_BLOCK * config.aiNum * BET_UNIT;
+    Welford net;
+    for(int64_t block : candidate.blockNet){
+        net.add(block / scale);
+    }
+    return net;
+}
+
+//Difference between two candidates' net per round, taken block by block. Both played the same cards, so most of the luck cancels out and the interval is far narrower than either net's
+static Welford pairedDifference(const SimulationConfig& config, const Candidate& a, const Candidate& b){
+    double scale = (double)ROUNDS_PER_BLOCK * config.aiNum * BET_UNIT;
+    Welford difference;
+    for(size_t i = 0; i < a.blockNet.size(); i++){
+        difference.add((a.blockNet[i] - b.blockNet[i]) / scale);
+    }
+    return difference;
+}
+
+template<class R>
+static void optimize(const SimulationConfig& config){
+    vector<Candidate> candidates = makeCandidates();
+    Candidate basic; //Played alongside every stage as the yardstick, but never ranked
+    basic.table = BASIC_STRATEGY;
+    
+    //Stages until at most FINALISTS are left. The last stage plays every block; each stage before it plays half as many as the next
+    int stages = 1;
+    for(size_t n = candidates.size(); n > FINALISTS; n = (n + 1) / 2){
+        stages++;
+    }
+    long long finalBlocks = (config.optimizeRounds + ROUNDS_PER_BLOCK - 1) / ROUNDS_PER_BLOCK;
+    
+    cout << "Searching " << candidates.size() << " AI strategies in " << stages << " stages on the same cards (seed " << config.seed << ")" << endl;
+    cout << fixed << setprecision(4);
+    
+    vector<Candidate*> players;
+    for(Candidate& candidate : candidates){
+        players.push_back(&candidate);
+    }
+    long long played = 0;
+    for(int stage = 0; stage < stages; stage++){
+        long long blocks = max(1LL, finalBlocks >> (stages - 1 - stage));
+        if(blocks > played){
+            players.push_back(&basic);
+            runStage<R>(config, players, played, blocks);
+            players.pop_back();
+            played = blocks;
+        }
+        
+        //Ranks the candidates by their net over the same blocks (ties keep the search order, so the result doesn't depend on timing) and drops the worse half
+        stable_sort(players.begin(), players.end(), [](const Candidate* a, const Candidate* b){
+            return a->total() > b->total();
+        });
+        cout << "Stage " << stage + 1 << ": " << players.size() << " strategies, " << played * ROUNDS_PER_BLOCK << " rounds each. Leader: " << describe(players[0]->params) << ", net " << showpos << netPerRound(config, *players[0]).mean << noshowpos << endl;
+        if(stage < stages - 1){
+            players.resize((players.size() + 1) / 2);
+        }
+    }
+    
+    Welford basicNet = netPerRound(config, basic);
+    cout << "Best strategies (" << played * ROUNDS_PER_BLOCK << " rounds each, net per round in bets with 95% intervals):" << endl;
+    for(size_t i = 0; i < players.size(); i++){
+        Welford net = netPerRound(config, *players[i]);
+        Welford gain = pairedDifference(config, *players[i], basic);
+        cout << i + 1 << ". " << describe(players[i]->params) << ": net " << showpos << net.mean << noshowpos << " +/- " << net.halfWidth() << ", against basic strategy " << showpos << gain.mean << noshowpos << " +/- " << gain.halfWidth() << endl;
+    }
+    cout << "Basic strategy: net " << showpos << basicNet.mean << noshowpos << " +/- " << basicNet.halfWidth() << endl;
+}
+
+//Turns the rule flags in the config into template arguments, like the simulation does, so every rule set searches with its own compiled round loop
+template<bool... Fixed>
+static void dispatchRules(const SimulationConfig& config){
+    constexpr size_t fixedNum = sizeof...(Fixed);
+    if constexpr(fixedNum == 4){
+        optimize<Rules<Fixed...>>(config);
+    }else{
+        const bool flags[4] = {config.hitSoft17, config.sixToFive, config.canDouble, config.canSplit};
+        if(flags[fixedNum]){
+            dispatchRules<Fixed..., true>(config);
+        }else{
+            dispatchRules<Fixed..., false>(config);
+        }
+    }
+}
+
+void optimizeStrategy(const SimulationConfig& config){
+    dispatchRules<>(config);
+}
@@ -0,0 +1,20 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "Simulation.h"
+
+//The stand thresholds the optimizer searches over: a hard threshold for each group of dealer upcards and one soft threshold
+const int UPCARD_GROUPS = 3; //Dealer 2-3, 4-6 and 7-ace
+const int MIN_HARD_STAND = 12;
+const int MAX_HARD_STAND = 18;
+const int MIN_SOFT_STAND = 17;
+const int MAX_SOFT_STAND = 20;
+
+const int FINALISTS = 4; //The halving stops once this few strategies are left, and they play the full number of rounds
+const int TASKS_PER_THREAD = 4; //Each stage is cut into about this many tasks per thread, so threads that finish early have work to take
+
+//Searches for the AI stand thresholds with the best net result per round under the config's rules, and prints the best few against basic strategy
+//Every strategy plays the same rounds, each dealt from its own fresh shoe of (seed, block, round), so they all get the same cards in the same order (common random numbers) and only part ways where their decisions do. Compared round by round on the same cards, two strategies are told apart in far fewer rounds than independent runs would take. Since every round starts a full shoe, there is no cut card and no count to follow. The search is successive halving: every strategy plays a few blocks, the worse half is dropped, and the rest play twice as many, until FINALISTS strategies have played config.optimizeRounds rounds
+void optimizeStrategy(const SimulationConfig& config);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef PLAYER_H
+#define PLAYER_H
+
+#include "Hand.h"
+#include "Profile.h"
+#include "Shoe.h"
+#include "Renderer.h"
+#include <string>
+
+//Player class to hold members that control a players actions
+class Player{
+private:
+    //Private attributes like the individual players name, hand, and whether they've stayed or busted
+    std::string name;
+    Hand hand;
+public:
+    Player(std::string playerName) : name(playerName) {} //Player constructor that takes the name parameter
+    
+    //Passes through the shoe by reference so the card is dealt from the shared shoe, and not from a copy
+    void addCard(Shoe& shoe){
+        hand.add(shoe.draw());
+    }
+    
+    //Returns the players hand total, which the hand keeps up to date as cards are added
+    int calculateHT(){
+        PROFILE_COUNT(COUNT_CALCULATE_HT);
+        return hand.getTotal();
+    }
+    
+    //Adds the players hand to the frame
+    void printHand(Renderer& render){
+        render.hand(hand);
+    }
+   
+    //Checks if player handtotal is greater than 21, if so return a true such that the player has busted
+    bool checkBust(){
+        return hand.isBust();
+    }
+    
+    //Get function returns users name by reference, so printing it doesn't copy the string
+    const std::string& getName(){
+        return name;
+    }
+    
+    //Get function that returns the players hand
+    Hand& getHand(){
+        return hand;
+    }
+    
+    //Resets the players hand
+    void resetHand(){
+        hand.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include "Profile.h"
+
+#ifdef BLACKJACK_PROFILE
+
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib> //atexit
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//Names of the phases and counters as printed
+static const char* const PHASE_NAMES[PHASE_COUNT] = {"shuffle", "deal", "dealer", "players", "ai", "settle", "round"};
+static const char* const COUNTER_NAMES[COUNTER_COUNT] = {"reshuffles", "calculateHT calls"};
+
+static mutex registryLock; //Guards profiles
+static vector<ThreadProfile*> profiles; //Every thread's profile, never freed so dumps can still read them after the thread is gone
+static atomic<bool> dumpRequested{false};
+
+//Tick and clock readings taken by profileStart, to turn ticks into nanoseconds
+static uint64_t startTicks = 0;
+static chrono::steady_clock::time_point startTime;
+
+//Thread that prints the profile on SIGUSR1. It's joined before the exit dump, so it's never still running while the program's statics are torn down
+static thread watcher;
+static mutex watcherLock;
+static condition_variable watcherWake;
+static bool watcherStopping = false;
+
+ThreadProfile& threadProfile(){
+    thread_local ThreadProfile* profile = nullptr;
+    if(!profile){
+        profile = new ThreadProfile();
+        lock_guard<mutex> guard(registryLock);
+        profiles.push_back(profile);
+    }
+    return *profile;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other){
+    for(int i = 0; i < HISTOGRAM_BUCKETS; i++){
+        bump(buckets[i], other.buckets[i].load(memory_order_relaxed));
+    }
+    bump(count, other.getCount());
+    bump(sum, other.getSum());
+    if(other.getMax() > getMax()){
+        max.store(other.getMax(), memory_order_relaxed);
+    }
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const{
+    uint64_t wanted = (uint64_t)(fraction * getCount());
+    uint64_t seen = 0;
+    for(int i = 0; i < HISTOGRAM_BUCKETS; i++){
+        seen += buckets[i].load(memory_order_relaxed);
+        if(seen > wanted){
+            return bucketStart(i);
+        }
+    }
+    return getMax();
+}
+
+//Nanoseconds per tick, measured against the steady clock since the program started
+static double nanosPerTick(){
+#if defined(__x86_64__) || defined(__i386__)
+    auto elapsed = chrono::steady_clock::now() - startTime;
+    if(elapsed < chrono::milliseconds(10)){
+        this_thread::sleep_for(chrono::milliseconds(10) - elapsed); //Too short a run to measure the tick rate against
+        elapsed = chrono::steady_clock::now() - startTime;
+    }
+    return chrono::duration<double, nano>(elapsed).count() / (profileTicks() - startTicks);
+#else
+    return 1;
+#endif
+}
+
+void profileDump(ostream& out){
+    LatencyHistogram total[PHASE_COUNT];
+    uint64_t counters[COUNTER_COUNT] = {};
+    size_t threads;
+    {
+        lock_guard<mutex> guard(registryLock);
+        threads = profiles.size();
+        for(ThreadProfile* profile : profiles){
+            for(int p = 0; p < PHASE_COUNT; p++){
+                total[p].merge(profile->phases[p]);
+            }
+            for(int c = 0; c < COUNTER_COUNT; c++){
+                counters[c] += profile->counters[c].load(memory_order_relaxed);
+            }
+        }
+    }
+    
+    double scale = nanosPerTick();
+    out << "Round profile, " << threads << " thread(s), times in ns:\n";
+    out << left << setw(10) << "phase" << right << setw(12) << "count" << setw(10) << "mean" << setw(10) << "p50" << setw(10) << "p90" << setw(10) << "p99" << setw(10) << "p99.9" << setw(12) << "max" << "\n";
+    out << fixed << setprecision(0);
+    for(int p = 0; p < PHASE_COUNT; p++){
+        const LatencyHistogram& h = total[p];
+        if(h.getCount() == 0){
+            continue;
+        }
+        out << left << setw(10) << PHASE_NAMES[p] << right << setw(12) << h.getCount() << setw(10) << h.getSum() * scale / h.getCount();
+        for(double fraction : {0.5, 0.9, 0.99, 0.999}){
+            out << setw(10) << h.percentile(fraction) * scale;
+        }
+        out << setw(12) << h.getMax() * scale << "\n";
+    }
+    for(int c = 0; c < COUNTER_COUNT; c++){
+        out << COUNTER_NAMES[c] << ": " << counters[c] << "\n";
+    }
+    out << defaultfloat << flush;
+}
+
+static void requestDump(int){
+    dumpRequested.store(true); //Only sets a flag: printing isn't safe inside a signal handler
+}
+
+static void dumpAtExit(){
+    {
+        lock_guard<mutex> guard(watcherLock);
+        watcherStopping = true;
+    }
+    watcherWake.notify_one();
+    if(watcher.joinable()){
+        watcher.join();
+    }
+    profileDump(cerr);
+}
+
+void profileStart(){
+    startTicks = profileTicks();
+    startTime = chrono::steady_clock::now();
+    signal(SIGUSR1, requestDump);
+    atexit(dumpAtExit);
+    
+    //Checks for SIGUSR1 ten times a second and prints from a normal thread, until the exit dump stops it
+    watcher = thread([]{
+        unique_lock<mutex> guard(watcherLock);
+        while(!watcherWake.wait_for(guard, chrono::milliseconds(100), []{ return watcherStopping; })){
+            if(dumpRequested.exchange(false)){
+                profileDump(cerr);
+            }
+        }
+    });
+}
+
+#endif
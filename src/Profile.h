@@ -0,0 +1,168 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+//Per-phase round profiling. Built only with the BLACKJACK_PROFILE option (cmake -DBLACKJACK_PROFILE=ON); without it every PROFILE_ macro expands to nothing and the game has no trace of it
+//Each thread times the phases of its rounds into its own latency histograms. The histograms of every thread are printed to stderr when the program exits and whenever it gets SIGUSR1
+
+//Phases of a round, in the order they're played
+enum ProfilePhase{
+    PHASE_SHUFFLE, //Checking the cut card and reshuffling
+    PHASE_DEAL, //Opening cards for every seat and the dealer
+    PHASE_DEALER, //Dealer::play
+    PHASE_PLAYERS, //Human turns, waiting on input included
+    PHASE_AI, //AI::play for every AI seat
+    PHASE_SETTLE, //Settling the seat table, logging and reporting the results
+    PHASE_ROUND, //The whole round
+    PHASE_COUNT
+};
+
+//Events that are counted instead of timed
+enum ProfileCounter{
+    COUNT_RESHUFFLE, //Shoes reshuffled by checkDeckSize
+    COUNT_CALCULATE_HT, //calculateHT calls on players, AIs and the dealer
+    COUNTER_COUNT
+};
+
+#ifdef BLACKJACK_PROFILE
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+//Returns the current time in ticks: CPU cycles where the time stamp counter can be read, nanoseconds elsewhere. Ticks are turned into nanoseconds when the histograms are printed
+inline uint64_t profileTicks(){
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+const int HISTOGRAM_SUB_BITS = 4; //Every power of two is split into 16 buckets, so a bucket is within 1/16 (6%) of any value in it
+const int HISTOGRAM_LINEAR = 2 << HISTOGRAM_SUB_BITS; //Values below this get a bucket each
+const int HISTOGRAM_BUCKETS = HISTOGRAM_LINEAR + (64 - HISTOGRAM_SUB_BITS - 1) * (1 << HISTOGRAM_SUB_BITS);
+
+//LatencyHistogram class counts durations in buckets of roughly equal relative width (HDR-style), so any duration from a few cycles to hours is recorded in a fixed 8 KB with constant precision
+//Only its own thread records into it; other threads may read it at any time. Every counter is an atomic that's loaded and stored instead of locked, which costs the same as a plain add
+class LatencyHistogram{
+private:
+    std::atomic<uint64_t> buckets[HISTOGRAM_BUCKETS] = {};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+    
+    static void bump(std::atomic<uint64_t>& counter, uint64_t by){
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+public:
+    //Returns the bucket of a duration
+    static int bucketOf(uint64_t ticks){
+        if(ticks < (uint64_t)HISTOGRAM_LINEAR){
+            return (int)ticks;
+        }
+        int exponent = 63 - __builtin_clzll(ticks);
+        int sub = (int)(ticks >> (exponent - HISTOGRAM_SUB_BITS)) & ((1 << HISTOGRAM_SUB_BITS) - 1);
+        return HISTOGRAM_LINEAR + (exponent - HISTOGRAM_SUB_BITS - 1) * (1 << HISTOGRAM_SUB_BITS) + sub;
+    }
+    
+    //Returns the smallest duration that falls in a bucket
+    static uint64_t bucketStart(int bucket){
+        if(bucket < HISTOGRAM_LINEAR){
+            return bucket;
+        }
+        int exponent = (bucket - HISTOGRAM_LINEAR) / (1 << HISTOGRAM_SUB_BITS) + HISTOGRAM_SUB_BITS + 1;
+        uint64_t sub = (bucket - HISTOGRAM_LINEAR) % (1 << HISTOGRAM_SUB_BITS);
+        return ((1ULL << HISTOGRAM_SUB_BITS) | sub) << (exponent - HISTOGRAM_SUB_BITS);
+    }
+    
+    void record(uint64_t ticks){
+        bump(buckets[bucketOf(ticks)], 1);
+        bump(count, 1);
+        bump(sum, ticks);
+        if(ticks > max.load(std::memory_order_relaxed)){
+            max.store(ticks, std::memory_order_relaxed);
+        }
+    }
+    
+    //Adds another histogram's counts onto this one, for printing every thread together
+    void merge(const LatencyHistogram& other);
+    
+    uint64_t getCount() const{
+        return count.load(std::memory_order_relaxed);
+    }
+    
+    uint64_t getSum() const{
+        return sum.load(std::memory_order_relaxed);
+    }
+    
+    uint64_t getMax() const{
+        return max.load(std::memory_order_relaxed);
+    }
+    
+    //Returns the duration below which the given fraction of the recorded durations fall (the start of its bucket)
+    uint64_t percentile(double fraction) const;
+};
+
+//ThreadProfile struct holds one thread's histograms and counters. It's made the first time the thread records anything and kept until the program exits, so a finished worker thread still shows up in the final dump
+struct ThreadProfile{
+    LatencyHistogram phases[PHASE_COUNT];
+    std::atomic<uint64_t> counters[COUNTER_COUNT] = {};
+};
+
+//Returns the calling thread's profile
+ThreadProfile& threadProfile();
+
+//PhaseTimer class times the phases of one round one after the other: every lap records the time since the previous lap into its phase, and finish records the whole round
+class PhaseTimer{
+private:
+    ThreadProfile& profile;
+    uint64_t start;
+    uint64_t last;
+public:
+    PhaseTimer() : profile(threadProfile()), start(profileTicks()), last(start) {}
+    
+    void lap(ProfilePhase phase){
+        uint64_t now = profileTicks();
+        profile.phases[phase].record(now - last);
+        last = now;
+    }
+    
+    void finish(){
+        profile.phases[PHASE_ROUND].record(profileTicks() - start);
+    }
+};
+
+inline void profileCount(ProfileCounter counter){
+    std::atomic<uint64_t>& value = threadProfile().counters[counter];
+    value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+//Installs the SIGUSR1 handler and the exit dump. Call it once at the start of main
+void profileStart();
+
+//Prints every thread's phases merged: count, mean, percentiles and maximum in nanoseconds, then the counters
+void profileDump(std::ostream& out);
+
+#define PROFILE_ROUND(timer) PhaseTimer timer
+#define PROFILE_LAP(timer, phase) timer.lap(phase)
+#define PROFILE_FINISH(timer) timer.finish()
+#define PROFILE_COUNT(counter) profileCount(counter)
+#define PROFILE_START() profileStart()
+
+#else
+
+#define PROFILE_ROUND(timer)
+#define PROFILE_LAP(timer, phase)
+#define PROFILE_FINISH(timer)
+#define PROFILE_COUNT(counter)
+#define PROFILE_START()
+
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+#include "Renderer.h"
+#include <cstring>
+
+using namespace std;
+
+//Each time a card is drawn, this function gets called. Appends the card's 7 rows onto the end of the 7 row strings, so several cards called in a row end up side by side. Takes in a constant card parameter by reference (since the specific card being passed through doesn't change), and a boolean set to false, but if the dealer calls this function on its first turn will draw the hidden card
+void ASCII(string rows[CARD_ROWS], const Card& card, bool hidden){
+    if(hidden){//If hidden = true, draw the back of the card
+        rows[0] += "__________";
+        rows[1] += "|########|";
+        rows[2] += "|########|";
+        rows[3] += "|########|";
+        rows[4] += "|########|";
+        rows[5] += "|########|";
+        rows[6] += "[________]";
+        return;//Exits the function early
+    }
+    
+    //Look up the initial of the cards rank, and the symbol of its suit. The rank and its padding fill the 7 characters beside the card's border, so a wider rank like "10" gets less padding
+    const char* displayRank = RANK_NAMES[card.rank()];
+    const char* displaySuit = SUIT_SYMBOLS[card.suit()];
+    string padding(7 - strlen(displayRank), ' ');
+    
+    //Draw the card with a design and the displayRank/Suit
+    rows[0] += "__________";
+    rows[1] += "| "; rows[1] += displayRank; rows[1] += padding; rows[1] += "|";
+    rows[2] += "|        |";
+    rows[3] += "|    "; rows[3] += displaySuit; rows[3] += "   |";
+    rows[4] += "|        |";
+    rows[5] += "|"; rows[5] += padding; rows[5] += displayRank; rows[5] += " |";
+    rows[6] += "[________]";
+}
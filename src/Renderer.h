@@ -0,0 +1,101 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "Card.h"
+#include "Hand.h"
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+const int CARD_ROWS = 7; //Number of text rows in a drawn card
+
+//Each time a card is drawn, this function gets called. Appends the card's 7 rows onto the end of the 7 row strings, so several cards called in a row end up side by side. Takes in a constant card parameter by reference (since the specific card being passed through doesn't change), and a boolean set to false, but if the dealer calls this function on its first turn will draw the hidden card
+void ASCII(std::string rows[CARD_ROWS], const Card& card, bool hidden = false);
+
+//How much the game prints: every card drawn (FULL), hands as one line of text (QUIET), or only the round results and final scores (SUMMARY_ONLY)
+enum Verbosity{
+    FULL,
+    QUIET,
+    SUMMARY_ONLY
+};
+
+//Renderer class collects everything printed for one frame (up to the next prompt, or the end of the round) in a single buffer, then writes it to the terminal in one go instead of flushing every line
+class Renderer{
+private:
+    Verbosity level;
+    std::ostream* out; //Where frames are written, the terminal unless told otherwise
+    std::string frame; //Text waiting to be written. Keeps its memory between frames
+    std::string rows[CARD_ROWS]; //Rows of the cards being drawn side by side
+public:
+    Renderer(Verbosity v = FULL, std::ostream& stream = std::cout) : level(v), out(&stream) {}
+    
+    //Adds a line about the table (hands, totals, what each seat did). Skipped when only the summary is wanted
+    void line(const std::string& text){
+        if(level != SUMMARY_ONLY){
+            frame += text;
+            frame += '\n';
+        }
+    }
+    
+    //Adds a line that is always shown: round results and final scores
+    void result(const std::string& text){
+        frame += text;
+        frame += '\n';
+    }
+    
+    //Adds a hand of cards side by side, or as a line of text in QUIET mode. If hideSecond is true, only the first two cards are shown and the second one is face down
+    void hand(const Hand& hand, bool hideSecond = false){
+        if(level == SUMMARY_ONLY){
+            return;
+        }
+        int shown = hideSecond ? std::min(hand.size(), 2) : hand.size();
+        if(level == QUIET){
+            for(int i = 0; i < shown; i++){
+                if(i > 0){
+                    frame += ' ';
+                }
+                if(hideSecond && i == 1){
+                    frame += "##";
+                }else{
+                    frame += RANK_NAMES[hand.card(i).rank()];
+                    frame += SUIT_SYMBOLS[hand.card(i).suit()];
+                }
+            }
+            frame += '\n';
+            return;
+        }
+        
+        for(int r = 0; r < CARD_ROWS; r++){
+            rows[r].clear();
+        }
+        for(int i = 0; i < shown; i++){
+            if(i > 0){
+                for(int r = 0; r < CARD_ROWS; r++){
+                    rows[r] += ' ';
+                }
+            }
+            ASCII(rows, hand.card(i), hideSecond && i == 1);
+        }
+        for(int r = 0; r < CARD_ROWS; r++){
+            frame += rows[r];
+            frame += '\n';
+        }
+    }
+    
+    //Adds a prompt (always shown, without a newline so the answer is typed after it) and writes the frame out so the prompt is on screen before reading input
+    void prompt(const std::string& text){
+        frame += text;
+        flush();
+    }
+    
+    //Writes the whole frame to the terminal with a single write
+    void flush(){
+        if(!frame.empty()){
+            out->write(frame.data(), frame.size());
+            out->flush();
+            frame.clear();
+        }
+    }
+};
+
+#endif
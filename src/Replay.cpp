@@ -0,0 +1,215 @@
+#include "Card.h"
+#include "Hand.h"
+#include "RoundLog.h"
+#include "Rules.h"
+#include "SeatTable.h" //formatBets
+#include "Shoe.h"
+#include "Simulation.h"
+#include <chrono> //steady_clock for the scan speed
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//Prints the command-line options
+void printUsage(const char* program){
+    cout << "Usage: " << program << " LOG [--round N] [--session S] [--verify]" << endl;
+    cout << "  --round N      Print every event of round N (rounds are numbered from 0 in each session, a simulation's block B holds rounds B*" << ROUNDS_PER_BLOCK << " onwards)" << endl;
+    cout << "  --session S    Only look at session S of the log, numbered from 1 (default: every session)" << endl;
+    cout << "  --verify       Deal every shoe again from the session's seed and check each logged card against it" << endl;
+    cout << "Without --round, prints a summary of the whole log." << endl;
+}
+
+//Returns a seat number from the log as text
+string seatName(int seat){
+    if(seat == DEALER_SEAT){
+        return "Dealer";
+    }
+    string name = "Seat " + to_string((seat & ~SPLIT_HAND) + 1);
+    return seat & SPLIT_HAND ? name + " (split hand)" : name;
+}
+
+int main(int argc, char* argv[]){
+    string path;
+    long long wantedRound = -1; //Round to print, -1 for the summary
+    long long wantedSession = 0; //Session to look at, 0 for all
+    bool verify = false;
+    
+    //Reads the command-line options
+    for(int i = 1; i < argc; i++){
+        string arg = argv[i];
+        if(arg == "--round" && i + 1 < argc){
+            wantedRound = atoll(argv[++i]);
+        }else if(arg == "--session" && i + 1 < argc){
+            wantedSession = atoll(argv[++i]);
+        }else if(arg == "--verify"){
+            verify = true;
+        }else if(path.empty() && arg[0] != '-'){
+            path = arg;
+        }else{
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if(path.empty()){
+        printUsage(argv[0]);
+        return 1;
+    }
+    
+    LogReader reader;
+    if(!reader.open(path)){
+        cout << "Can't open " << path << endl;
+        return 1;
+    }
+    
+    auto start = chrono::steady_clock::now();
+    
+    //Counters for the whole log
+    long long sessions = 0, blocks = 0, rounds = 0, shuffles = 0, events = 0, mismatches = 0, printedRounds = 0;
+    string firstMismatch;
+    vector<long long> seatNet(MAX_LOG_SEATS, 0); //Net result of each seat across the log, in tenths of a bet
+    int seatCount = 0; //Most seats any session had
+    
+    //State of the session being read
+    uint64_t seed = 0;
+    Shoe shoe(1, 1.0, 0); //The shoe the session dealt from, rebuilt for every session when verifying
+    long long nextRound = 0; //Number of the next round in the session
+    long long currentRound = -1;
+    bool inSession = false; //The session passes the --session filter
+    bool printing = false; //The current round is being printed
+    Hand hands[256]; //Every hand of the round being printed, indexed by its seat number in the log
+    
+    LogRecord record;
+    string error;
+    while(reader.next(record, error)){
+        events++;
+        if(record.tag == EVENT_TABLE){
+            sessions++;
+            inSession = wantedSession == 0 || wantedSession == sessions;
+            seed = record.value;
+            nextRound = 0;
+            printing = false;
+            if(inSession){
+                seatCount = max(seatCount, record.seats);
+                if(verify){
+                    shoe = Shoe(record.decks, 1.0, seed);
+                }
+                if(wantedRound >= 0){
+                    cout << "Session " << sessions << ": seed " << seed << ", " << record.decks << " deck(s), " << record.seats << " seat(s), dealer " << (record.rules & LOG_HIT_SOFT_17 ? "hits soft 17" : "stands on 17") << ", blackjack pays " << (record.rules & LOG_SIX_TO_FIVE ? "6:5" : "3:2") << endl;
+                }
+            }
+            continue;
+        }
+        if(!inSession){
+            continue;
+        }
+        
+        switch(record.tag){
+            case EVENT_BLOCK:
+                blocks++;
+                nextRound = record.value * ROUNDS_PER_BLOCK;
+                printing = false;
+                if(verify){
+                    shoe.restart(seed, record.value);
+                }
+                break;
+            case EVENT_SHUFFLE:
+                shuffles++;
+                if(verify){
+                    shoe.shuffle();
+                }
+                if(printing){
+                    cout << "  Shoe reshuffled" << endl;
+                }
+                break;
+            case EVENT_ROUND:
+                rounds++;
+                currentRound = nextRound++;
+                printing = currentRound == wantedRound;
+                if(printing){
+                    printedRounds++;
+                    cout << "Round " << currentRound << endl;
+                    for(int i = 0; i < 256; i++){
+                        hands[i].clear();
+                    }
+                }
+                break;
+            case EVENT_DEAL:
+                if(verify){
+                    Card dealt = shoe.draw();
+                    if(dealt.bits != record.card.bits){
+                        if(mismatches == 0){
+                            firstMismatch = "session " + to_string(sessions) + ", round " + to_string(currentRound) + ", byte " + to_string(reader.position());
+                        }
+                        mismatches++;
+                    }
+                }
+                if(printing){
+                    Hand& hand = hands[record.seat];
+                    hand.add(record.card);
+                    cout << "  " << seatName(record.seat) << " is dealt " << RANK_NAMES[record.card.rank()] << SUIT_SYMBOLS[record.card.suit()] << " (" << (hand.isSoft() ? "soft " : "") << hand.getTotal() << ")" << endl;
+                }
+                break;
+            case EVENT_HIT:
+            case EVENT_STAND:
+            case EVENT_DOUBLE:
+            case EVENT_SPLIT:
+                if(printing){
+                    const char* actions[] = {"hits", "stands", "doubles down", "splits"};
+                    cout << "  " << seatName(record.seat) << " " << actions[record.tag - EVENT_HIT] << endl;
+                    if(record.tag == EVENT_SPLIT){
+                        //The second card becomes the first card of the split hand
+                        Hand& hand = hands[record.seat];
+                        Card second = hand.card(1);
+                        Card first = hand.card(0);
+                        hand.clear();
+                        hand.add(first);
+                        hands[record.seat | SPLIT_HAND].add(second);
+                    }
+                }
+                break;
+            case EVENT_RESULT:
+                if(record.seat < MAX_LOG_SEATS){
+                    seatNet[record.seat] += record.net;
+                }
+                if(printing){
+                    const char* outcomes[] = {"loses", "ties", "wins"};
+                    cout << "  " << seatName(record.seat) << " " << outcomes[record.outcome + 1] << ", net " << formatBets(record.net) << endl;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    
+    if(!error.empty()){
+        cout << "Log error: " << error << endl;
+    }
+    if(wantedRound >= 0 && printedRounds == 0){
+        cout << "Round " << wantedRound << " isn't in the log" << endl;
+    }
+    
+    //Summary of the whole log
+    if(wantedRound < 0){
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double megabytes = reader.position() / 1e6;
+        cout << fixed << setprecision(1);
+        cout << "Sessions: " << sessions << "  Blocks: " << blocks << "  Rounds: " << rounds << "  Shuffles: " << shuffles << endl;
+        cout << "Events: " << events << " in " << megabytes << " MB (" << (rounds ? (double)reader.position() / rounds : 0) << " bytes per round), scanned at " << megabytes / seconds << " MB/s" << endl;
+        for(int seat = 0; seat < seatCount; seat++){
+            cout << seatName(seat) << " net: " << formatBets(seatNet[seat]) << " bets" << endl;
+        }
+    }
+    if(verify){
+        if(mismatches == 0){
+            cout << "Every logged card matches the shoe dealt from its seed" << endl;
+        }else{
+            cout << mismatches << " logged card(s) don't match the shoe dealt from the seed, the first one in " << firstMismatch << endl;
+        }
+    }
+    
+    return error.empty() && mismatches == 0 ? 0 : 1;
+}
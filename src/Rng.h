@@ -0,0 +1,83 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+//Rng class is the random number generator used for every shuffle and AI choice in the game. It is a xoshiro256** generator: four 64-bit words of state and a few shifts per number, much cheaper than building a new engine for every shuffle
+//Each generator is started from a seed plus a stream number (for example a simulation block), so separate streams never depend on each other and any stream can be recreated from (seed, stream) alone
+class Rng{
+private:
+    uint64_t state[4];
+    
+    //SplitMix64 step used to spread the seed and stream number over the whole state
+    static uint64_t splitMix(uint64_t& x){
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    
+    static uint64_t rotl(uint64_t x, int k){
+        return (x << k) | (x >> (64 - k));
+    }
+public:
+    typedef uint64_t result_type; //Lets Rng be passed to standard library algorithms that take a random engine
+    
+    Rng(uint64_t seed = 0, uint64_t stream = 0, uint64_t substream = 0){
+        reseed(seed, stream, substream);
+    }
+    
+    //Restarts the generator on the given seed and stream. A non-zero substream splits a stream further (for example the reshuffles of one shoe), and substream 0 is the stream itself
+    void reseed(uint64_t seed, uint64_t stream = 0, uint64_t substream = 0){
+        uint64_t x = seed;
+        uint64_t mixedStream = splitMix(x) ^ stream; //Hashing the seed first keeps (seed, stream) and (seed + 1, stream - 1) apart
+        x = mixedStream;
+        if(substream != 0){
+            x = splitMix(x) ^ substream; //Hashed the same way, so (stream, substream) pairs stay apart too
+        }
+        for(int i = 0; i < 4; i++){
+            state[i] = splitMix(x);
+        }
+    }
+    
+    //Returns the next 64 random bits
+    uint64_t next(){
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+    
+    //Returns a uniform random number in [0, n) using Lemire's multiply-and-reject method, which avoids a division on almost every call
+    uint32_t below(uint32_t n){
+        uint64_t m = (next() >> 32) * n;
+        uint32_t low = (uint32_t)m;
+        if(low < n){
+            uint32_t threshold = -n % n;
+            while(low < threshold){
+                m = (next() >> 32) * n;
+                low = (uint32_t)m;
+            }
+        }
+        return m >> 32;
+    }
+    
+    uint64_t operator()(){
+        return next();
+    }
+    
+    static constexpr uint64_t min(){
+        return 0;
+    }
+    
+    static constexpr uint64_t max(){
+        return ~0ULL;
+    }
+};
+
+#endif
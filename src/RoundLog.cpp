@@ -0,0 +1,152 @@
+#include "RoundLog.h"
+#include <cstring>
+
+using namespace std;
+
+//Size of each block read from a log
+const size_t LOG_CHUNK = 1 << 20;
+
+bool LogFile::open(const string& path){
+    close();
+    file = fopen(path.c_str(), "ab");
+    return file != nullptr;
+}
+
+bool LogFile::append(const uint8_t* data, size_t size){
+    lock_guard<mutex> guard(lock);
+    if(!failed && (fwrite(data, 1, size, file) != size || fflush(file) != 0)){
+        failed = true;
+    }
+    return !failed;
+}
+
+void LogFile::close(){
+    if(file){
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+void RoundLog::table(uint64_t seed, int decks, int seats, uint8_t rules){
+    event(EVENT_TABLE);
+    buffer.push_back(LOG_MAGIC[0]);
+    buffer.push_back(LOG_MAGIC[1]);
+    buffer.push_back(LOG_VERSION);
+    write64(seed);
+    buffer.push_back((uint8_t)decks);
+    buffer.push_back((uint8_t)seats);
+    buffer.push_back(rules);
+}
+
+void RoundLog::turn(int seat, const Hand& hand, bool doubled){
+    if(doubled){
+        event(EVENT_DOUBLE, seat);
+        deal(seat, hand.card(2));
+        return;
+    }
+    for(int i = 2; i < hand.size(); i++){
+        event(EVENT_HIT, seat);
+        deal(seat, hand.card(i));
+    }
+    if(!hand.isBust()){
+        event(EVENT_STAND, seat);
+    }
+}
+
+void RoundLog::splitTurn(int seat, const Hand& first, bool firstDoubled, const Hand& second, bool secondDoubled){
+    event(EVENT_SPLIT, seat);
+    deal(seat, first.card(1));
+    deal(seat | SPLIT_HAND, second.card(1));
+    if(first.card(0).rank() == ACE){
+        return;
+    }
+    turn(seat | SPLIT_HAND, second, secondDoubled);
+    turn(seat, first, firstDoubled);
+}
+
+LogReader::~LogReader(){
+    if(file){
+        fclose(file);
+    }
+}
+
+bool LogReader::open(const string& path){
+    file = fopen(path.c_str(), "rb");
+    return file != nullptr;
+}
+
+bool LogReader::fill(size_t need){
+    if(buffer.size() - pos >= need){
+        return true;
+    }
+    //Moves the unread bytes to the front and reads the next block after them
+    offset += pos;
+    buffer.erase(buffer.begin(), buffer.begin() + pos);
+    pos = 0;
+    size_t used = buffer.size();
+    buffer.resize(used + LOG_CHUNK);
+    size_t got = fread(buffer.data() + used, 1, LOG_CHUNK, file);
+    buffer.resize(used + got);
+    return buffer.size() >= need;
+}
+
+bool LogReader::next(LogRecord& record, string& error){
+    error.clear();
+    if(!fill(1)){
+        return false;
+    }
+    uint8_t tag = buffer[pos];
+    if(tag == 0 || tag >= EVENT_COUNT){
+        error = "unknown event " + to_string(tag) + " at byte " + to_string(position());
+        return false;
+    }
+    if(!fill(1 + EVENT_SIZES[tag])){
+        error = "log cut off at byte " + to_string(position());
+        return false;
+    }
+    uint64_t start = position();
+    const uint8_t* p = buffer.data() + pos + 1;
+    pos += 1 + EVENT_SIZES[tag];
+    
+    record = LogRecord();
+    record.tag = (LogEvent)tag;
+    switch(tag){
+        case EVENT_TABLE:
+            if(memcmp(p, LOG_MAGIC, 2) != 0 || p[2] != LOG_VERSION){
+                error = "not a round log, or an unsupported version";
+                return false;
+            }
+            for(int i = 0; i < 8; i++){
+                record.value |= (uint64_t)p[3 + i] << (8 * i);
+            }
+            record.decks = p[11];
+            record.seats = p[12];
+            record.rules = p[13];
+            break;
+        case EVENT_BLOCK:
+            for(int i = 0; i < 8; i++){
+                record.value |= (uint64_t)p[i] << (8 * i);
+            }
+            break;
+        case EVENT_DEAL:
+            record.seat = p[0];
+            record.card.bits = p[1];
+            break;
+        case EVENT_HIT:
+        case EVENT_STAND:
+        case EVENT_DOUBLE:
+        case EVENT_SPLIT:
+            record.seat = p[0];
+            break;
+        case EVENT_RESULT:
+            record.seat = p[0];
+            record.outcome = (int8_t)p[1];
+            record.net = (int16_t)(p[2] | (p[3] << 8));
+            if(record.outcome < -1 || record.outcome > 1){
+                error = "unknown outcome " + to_string(record.outcome) + " at byte " + to_string(start);
+                return false;
+            }
+            break;
+    }
+    return true;
+}
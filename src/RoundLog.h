@@ -0,0 +1,191 @@
+#ifndef ROUNDLOG_H
+#define ROUNDLOG_H
+
+#include "Card.h"
+#include "Hand.h"
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//Every event in a round log starts with one of these tags, followed by a fixed-size payload (see EVENT_SIZES)
+enum LogEvent : uint8_t{
+    EVENT_TABLE = 1, //A new session starts: magic, version, seed (8 bytes), decks, seats, rule flags
+    EVENT_BLOCK, //The shoe restarts on a block's own stream: block number (8 bytes)
+    EVENT_SHUFFLE, //The shoe is reshuffled
+    EVENT_ROUND, //A new round starts
+    EVENT_DEAL, //Seat, card
+    EVENT_HIT, //Seat
+    EVENT_STAND, //Seat
+    EVENT_DOUBLE, //Seat, followed by its one card
+    EVENT_SPLIT, //Seat, followed by the second card of both hands
+    EVENT_RESULT, //Seat, result of its hand (1 win, -1 loss, 0 tie), net result in tenths of a bet (2 bytes, little-endian)
+    EVENT_COUNT
+};
+
+//Payload size of each event, indexed by its tag. The log is a plain stream of tag + payload, with nothing in between
+const int EVENT_SIZES[EVENT_COUNT] = {0, 14, 8, 0, 0, 2, 1, 1, 1, 1, 4};
+
+const uint8_t LOG_MAGIC[2] = {'B', 'J'}; //First bytes of every table event, to catch a file that isn't a round log
+const uint8_t LOG_VERSION = 2; //Version 2 deals every reshuffle from its own number and has room for bets of any size in results
+
+//Seat numbers in the log: seats are numbered from 0, the dealer is DEALER_SEAT, and the top bit marks a seat's split hand
+const int DEALER_SEAT = 0x7F;
+const int SPLIT_HAND = 0x80;
+const int MAX_LOG_SEATS = DEALER_SEAT; //Seats 0-126 can be logged
+
+//Rule flags stored in the table event
+const uint8_t LOG_HIT_SOFT_17 = 1;
+const uint8_t LOG_SIX_TO_FIVE = 2;
+const uint8_t LOG_CAN_DOUBLE = 4;
+const uint8_t LOG_CAN_SPLIT = 8;
+
+//LogFile is the file a round log is appended to. Several RoundLogs (one per simulation thread) can append to it at once; each append is written whole, so a block of rounds is never interleaved with another thread's
+class LogFile{
+private:
+    FILE* file = nullptr;
+    std::mutex lock;
+    bool failed = false; //A write has failed, so nothing more is written
+public:
+    ~LogFile(){
+        close();
+    }
+    
+    //Opens the file for appending, so several sessions can share one log. Returns false if it can't be opened
+    bool open(const std::string& path);
+    
+    //Writes the bytes to the end of the file in one piece and flushes them, so the file holds every piece appended so far even if the process is killed. Returns false if the write fails; after that nothing more is written, so the log ends at the last whole piece that made it
+    bool append(const uint8_t* data, size_t size);
+    
+    bool hasFailed(){
+        std::lock_guard<std::mutex> guard(lock);
+        return failed;
+    }
+    
+    void close();
+};
+
+//RoundLog collects the events of one seat table in a memory buffer and appends them to a LogFile in large pieces. Events are written as they happen in the game, in the same order the cards come out of the shoe
+class RoundLog{
+private:
+    LogFile* file;
+    std::vector<uint8_t> buffer; //Events not yet written to the file
+    
+    void event(LogEvent tag){
+        buffer.push_back(tag);
+    }
+    
+    void event(LogEvent tag, int seat){
+        buffer.push_back(tag);
+        buffer.push_back((uint8_t)seat);
+    }
+    
+    void write64(uint64_t value){
+        for(int i = 0; i < 8; i++){
+            buffer.push_back((uint8_t)(value >> (8 * i))); //Little-endian on every machine
+        }
+    }
+public:
+    RoundLog(LogFile* out) : file(out){
+        buffer.reserve(1 << 18); //Room for a whole block of rounds at a typical table
+    }
+    
+    //Starts a session: the seed and table every later event belongs to
+    void table(uint64_t seed, int decks, int seats, uint8_t rules);
+    
+    void block(uint64_t number){
+        event(EVENT_BLOCK);
+        write64(number);
+    }
+    
+    void shuffle(){
+        event(EVENT_SHUFFLE);
+    }
+    
+    void round(){
+        event(EVENT_ROUND);
+    }
+    
+    void deal(int seat, Card card){
+        event(EVENT_DEAL, seat);
+        buffer.push_back(card.bits);
+    }
+    
+    //Logs both opening cards of a seat
+    void opening(int seat, Card first, Card second){
+        deal(seat, first);
+        deal(seat, second);
+    }
+    
+    //Logs a seat's turn from its final hand: a double and its card, or a hit for every card after the first two, then a stand unless the hand busted
+    void turn(int seat, const Hand& hand, bool doubled);
+    
+    //Logs the turn of a seat that split its pair, in the order the cards were dealt: the second card of both hands, the split hand's turn, then the first hand's turn. Split aces only get their one card
+    void splitTurn(int seat, const Hand& first, bool firstDoubled, const Hand& second, bool secondDoubled);
+    
+    //Logs the dealer's hits after the opening cards
+    void dealerTurn(const Hand& hand){
+        for(int i = 2; i < hand.size(); i++){
+            event(EVENT_HIT, DEALER_SEAT);
+            deal(DEALER_SEAT, hand.card(i));
+        }
+    }
+    
+    void result(int seat, int outcome, int net){
+        event(EVENT_RESULT, seat);
+        buffer.push_back((uint8_t)(int8_t)outcome);
+        buffer.push_back((uint8_t)net);
+        buffer.push_back((uint8_t)(net >> 8));
+    }
+    
+    //Appends every buffered event to the file. Returns false if it couldn't be written
+    bool flush(){
+        bool written = true;
+        if(!buffer.empty()){
+            written = file->append(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        return written;
+    }
+};
+
+//One decoded event. Only the fields its tag uses are set
+struct LogRecord{
+    LogEvent tag;
+    int seat = 0;
+    Card card;
+    int outcome = 0;
+    int net = 0;
+    uint64_t value = 0; //Seed (table) or block number (block)
+    int decks = 0;
+    int seats = 0;
+    uint8_t rules = 0;
+};
+
+//LogReader decodes a round log in one streaming pass, reading it in large blocks so a log of any size is scanned with a fixed amount of memory
+class LogReader{
+private:
+    FILE* file = nullptr;
+    std::vector<uint8_t> buffer;
+    size_t pos = 0; //Next unread byte in the buffer
+    uint64_t offset = 0; //File offset of the start of the buffer
+    
+    //Makes sure at least need bytes are waiting in the buffer. Returns false at the end of the file
+    bool fill(size_t need);
+public:
+    ~LogReader();
+    
+    //Returns false if the file can't be opened
+    bool open(const std::string& path);
+    
+    //Decodes the next event. Returns false at the end of the log, and sets error if the log is cut off or corrupt
+    bool next(LogRecord& record, std::string& error);
+    
+    //Returns the file offset of the next event
+    uint64_t position() const{
+        return offset + pos;
+    }
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef RULES_H
+#define RULES_H
+
+//Stakes and winnings are counted in tenths of a bet, so a 6:5 blackjack (1.2 bets) is still a whole number
+const int BET_UNIT = 10;
+
+//Winnings of a natural in tenths of a bet under each blackjack payout
+const int PAY_3_TO_2 = 15;
+const int PAY_6_TO_5 = 12;
+
+//Rules class holds a table's rule set as compile-time constants. The round loop takes the rules as a template parameter, so every rule set compiles into its own loop and a rule the table doesn't use is removed by the compiler instead of being checked every hand
+template<bool HitSoft17, bool SixToFive, bool CanDouble, bool CanSplit>
+struct Rules{
+    static constexpr bool HIT_SOFT_17 = HitSoft17; //Dealer hits a soft 17 instead of standing on it
+    static constexpr int BLACKJACK_PAY = SixToFive ? PAY_6_TO_5 : PAY_3_TO_2; //Tenths of a bet won by a natural
+    static constexpr bool CAN_DOUBLE = CanDouble; //A seat can double its bet on its first two cards for exactly one more card
+    static constexpr bool CAN_SPLIT = CanSplit; //A seat can split a pair once into two hands, each with its own bet
+};
+
+//Rules the AI seats play by at the interactive table, where every seat can only hit or stand
+typedef Rules<false, false, false, false> HitStandRules;
+
+#endif
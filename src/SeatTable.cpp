@@ -0,0 +1,79 @@
+#include "SeatTable.h"
+#include <string>
+
+using namespace std;
+
+string formatBets(int64_t tenths){
+    string sign = tenths < 0 ? "-" : "+";
+    int64_t amount = tenths < 0 ? -tenths : tenths;
+    return sign + to_string(amount / BET_UNIT) + "." + to_string(amount % BET_UNIT);
+}
+
+void SeatTable::settle(int dealerTotal, bool dealerNatural, int blackjackPay){
+    //A busted dealer counts as 0 and a busted seat counts as -1, and a natural counts as 22. With that, a plain comparison covers every win condition: a bust seat always loses (even if the dealer busts too), any other seat beats a busted dealer, and a natural beats any other 21 but ties another natural
+    int32_t dealer = dealerTotal > 21 ? 0 : dealerTotal + dealerNatural;
+    int32_t pay = blackjackPay;
+    int seats = totals.size();
+    const int32_t* total = totals.data();
+    const int32_t* busted = bust.data();
+    const int32_t* natural = naturals.data();
+    const int32_t* stake = stakes.data();
+    const int32_t* splitTotal = splitTotals.data();
+    const int32_t* splitBusted = splitBust.data();
+    const int32_t* splitStake = splitStakes.data();
+    int32_t* result = results.data();
+    int32_t* payout = payouts.data();
+    int64_t* win = wins.data();
+    int64_t* loss = losses.data();
+    int64_t* tie = ties.data();
+    int64_t* played = hands.data();
+    int64_t* money = net.data();
+    
+    for(int i = 0; i < seats; i++){
+        int32_t active = stake[i] != 0; //Masks out a seat that didn't play this round, like the split hand below
+        int32_t value = total[i] + natural[i];
+        int32_t seat = value - busted[i] * (value + 1); //-1 if busted, the total otherwise
+        int32_t won = active & (seat > dealer);
+        int32_t lost = active & (seat < dealer);
+        int32_t amount = stake[i] + natural[i] * (stake[i] * pay / BET_UNIT - stake[i]); //A natural is paid at the blackjack rate for its stake
+        
+        //The split hand is settled the same way, and masked out by its stake of 0 when the seat didn't split
+        int32_t split = splitTotal[i] - splitBusted[i] * (splitTotal[i] + 1);
+        int32_t hasSplit = splitStake[i] != 0;
+        int32_t splitWon = split > dealer;
+        int32_t splitLost = split < dealer;
+        
+        result[i] = won - lost;
+        win[i] += won + hasSplit * splitWon;
+        loss[i] += lost + hasSplit * splitLost;
+        tie[i] += active - won - lost + hasSplit * (1 - splitWon - splitLost);
+        played[i] += active + hasSplit;
+        payout[i] = (won - lost) * amount + (splitWon - splitLost) * splitStake[i];
+        money[i] += payout[i];
+    }
+}
+
+void SeatTable::merge(const SeatTable& other){
+    for(int i = 0; i < size(); i++){
+        wins[i] += other.wins[i];
+        losses[i] += other.losses[i];
+        ties[i] += other.ties[i];
+        hands[i] += other.hands[i];
+        net[i] += other.net[i];
+    }
+}
+
+void SeatTable::clearSeat(int seat){
+    wins[seat] = 0;
+    losses[seat] = 0;
+    ties[seat] = 0;
+    hands[seat] = 0;
+    net[seat] = 0;
+}
+
+void SeatTable::printScores(Renderer& render, int seat) const{
+    render.result("Wins: " + to_string(wins[seat]));
+    render.result("Losses: " + to_string(losses[seat]));
+    render.result("Ties: " + to_string(ties[seat]));
+    render.result("Net: " + formatBets(net[seat]) + " bets");
+}
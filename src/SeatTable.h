@@ -0,0 +1,139 @@
+#ifndef SEATTABLE_H
+#define SEATTABLE_H
+
+#include "Hand.h"
+#include "Renderer.h"
+#include "Rules.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//Formats an amount in tenths of a bet with its sign, e.g. +1.5
+std::string formatBets(int64_t tenths);
+
+//SeatScore struct holds one seat's score counters, for saving a seat and putting it back
+struct SeatScore{
+    int64_t wins = 0;
+    int64_t losses = 0;
+    int64_t ties = 0;
+    int64_t hands = 0;
+    int64_t net = 0;
+};
+
+//SeatTable class stores every seat at the table (players first, then AIs) as a struct of arrays: one array per field instead of one object per seat
+//After the seats have played, their hands are recorded into the table and the whole round is settled in one pass over the arrays with no branches, which the compiler can turn into SIMD code
+class SeatTable{
+private:
+    std::vector<int32_t> totals; //Final hand total of each seat this round
+    std::vector<int32_t> soft; //1 if the seat's hand is soft
+    std::vector<int32_t> bust; //1 if the seat busted
+    std::vector<int32_t> naturals; //1 if the seat was dealt a natural
+    std::vector<int32_t> stakes; //Bet on the seat's hand, in tenths of a bet
+    std::vector<int32_t> splitTotals; //Final total of the seat's split hand
+    std::vector<int32_t> splitBust; //1 if the split hand busted
+    std::vector<int32_t> splitStakes; //Bet on the split hand, 0 if the seat didn't split
+    std::vector<int32_t> results; //Result of the last settle: 1 win, -1 loss, 0 tie
+    std::vector<int32_t> payouts; //Net result of the last settle, in tenths of a bet
+    std::vector<int64_t> wins; //Hands won, lost and tied (a split counts as two hands)
+    std::vector<int64_t> losses;
+    std::vector<int64_t> ties;
+    std::vector<int64_t> hands;
+    std::vector<int64_t> net; //Money won minus money lost, in tenths of a bet
+public:
+    SeatTable(int seats = 0) : totals(seats, 0), soft(seats, 0), bust(seats, 0), naturals(seats, 0), stakes(seats, 0), splitTotals(seats, 0), splitBust(seats, 0), splitStakes(seats, 0), results(seats, 0), payouts(seats, 0), wins(seats, 0), losses(seats, 0), ties(seats, 0), hands(seats, 0), net(seats, 0) {}
+    
+    //Returns the number of seats in the table
+    int size() const{
+        return totals.size();
+    }
+    
+    //Copies a seat's final hand and its bet into the table
+    void record(int seat, const Hand& hand, int stake = BET_UNIT){
+        totals[seat] = hand.getTotal();
+        soft[seat] = hand.isSoft();
+        bust[seat] = hand.isBust();
+        naturals[seat] = hand.isNatural();
+        stakes[seat] = stake;
+        splitStakes[seat] = 0;
+    }
+    
+    //Leaves a seat out of the next settle: with no stake it neither wins, loses nor ties, so an empty seat or someone who sat down mid-round isn't scored
+    void skip(int seat){
+        stakes[seat] = 0;
+        splitStakes[seat] = 0;
+    }
+    
+    //Copies both hands of a seat that split. Neither hand can be a natural
+    void recordSplit(int seat, const Hand& first, int firstStake, const Hand& second, int secondStake){
+        record(seat, first, firstStake);
+        naturals[seat] = 0;
+        splitTotals[seat] = second.getTotal();
+        splitBust[seat] = second.isBust();
+        splitStakes[seat] = secondStake;
+    }
+    
+    //Compares every seat against the dealer's total and adds the result to each seat's counters. Seats with no stake are skipped. A natural beats any other 21 and wins blackjackPay tenths of a bet for every bet staked
+    void settle(int dealerTotal, bool dealerNatural = false, int blackjackPay = PAY_3_TO_2);
+    
+    //Adds another table's counters onto this one, seat by seat (used to merge the simulation threads)
+    void merge(const SeatTable& other);
+    
+    //Zeroes a seat's counters when someone new sits down in it
+    void clearSeat(int seat);
+    
+    //Returns a seat's score counters, and puts saved ones back
+    SeatScore getScore(int seat) const{
+        return {wins[seat], losses[seat], ties[seat], hands[seat], net[seat]};
+    }
+    
+    void setScore(int seat, const SeatScore& score){
+        wins[seat] = score.wins;
+        losses[seat] = score.losses;
+        ties[seat] = score.ties;
+        hands[seat] = score.hands;
+        net[seat] = score.net;
+    }
+    
+    //Adds a seat's final scores to the frame
+    void printScores(Renderer& render, int seat) const;
+    
+    //Get functions for a seat's last hand and result
+    int getTotal(int seat) const{
+        return totals[seat];
+    }
+    
+    bool isBust(int seat) const{
+        return bust[seat];
+    }
+    
+    int getResult(int seat) const{
+        return results[seat];
+    }
+    
+    int getPayout(int seat) const{
+        return payouts[seat];
+    }
+    
+    //Get functions that return a seat's score counters
+    int64_t getWins(int seat) const{
+        return wins[seat];
+    }
+    
+    int64_t getLosses(int seat) const{
+        return losses[seat];
+    }
+    
+    int64_t getTies(int seat) const{
+        return ties[seat];
+    }
+    
+    int64_t getHands(int seat) const{
+        return hands[seat];
+    }
+    
+    int64_t getNet(int seat) const{
+        return net[seat];
+    }
+};
+
+#endif
@@ -0,0 +1,527 @@
+#include "Server.h"
+#include "Table.h"
+#include <iostream>
+
+#ifdef __linux__
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#endif
+
+using namespace std;
+
+#ifdef __linux__
+
+const size_t MAX_LINE = 1024; //Longest command line. A connection that sends more without a newline is closed
+const size_t MAX_PENDING_OUTPUT = 1 << 20; //A connection that falls this far behind reading its output is closed
+const int MAX_EVENTS = 256; //Socket events handled per wait
+const uint64_t LISTEN_ID = 0; //epoll ids of the listening socket and the workers' wake-up eventfd. Connections are numbered after them
+const uint64_t WAKE_ID = 1;
+
+static atomic<bool> stopping(false);
+
+static void requestStop(int){
+    stopping = true;
+}
+
+//Returns a hash of a table name (FNV-1a) that is the same on every machine. It picks the table's worker and the stream its shoe is shuffled from
+static uint64_t tableHash(const string& name){
+    uint64_t hash = 14695981039346656037ULL;
+    for(unsigned char c : name){
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+//Messages the workers have produced for the connections, and the eventfd that wakes the I/O thread to send them
+struct Outbox{
+    mutex lock;
+    vector<TableMessage> messages;
+    int wake = -1;
+    
+    void post(vector<TableMessage>& out){
+        if(out.empty()){
+            return;
+        }
+        {
+            lock_guard<mutex> guard(lock);
+            for(TableMessage& message : out){
+                messages.push_back(move(message));
+            }
+        }
+        out.clear();
+        uint64_t one = 1;
+        ssize_t written = write(wake, &one, sizeof(one));
+        (void)written; //The eventfd counter can't overflow in practice, and a missed wake-up is caught by the next one
+    }
+};
+
+//What a worker is asked to do for a connection
+enum JobKind{
+    JOB_JOIN,
+    JOB_COMMAND,
+    JOB_LEAVE
+};
+
+struct TableJob{
+    JobKind kind;
+    uint64_t conn;
+    string table;
+    string text; //Player name for JOB_JOIN, the command line for JOB_COMMAND
+};
+
+//Worker class runs every table that hashes to it on its own thread, one job at a time
+class Worker{
+private:
+    const SimulationConfig& config;
+    Verbosity verbosity;
+    Outbox& outbox;
+    ShoeFeeder* feeder; //Shuffles ahead for every table's shoe, or null
+    mutex lock;
+    condition_variable ready;
+    deque<TableJob> jobs;
+    bool stop = false;
+    unordered_map<string, unique_ptr<Table>> tables;
+    thread runner;
+    
+    void handle(TableJob& job, vector<TableMessage>& out){
+        auto found = tables.find(job.table);
+        if(job.kind == JOB_JOIN){
+            if(found == tables.end()){
+                found = tables.emplace(job.table, unique_ptr<Table>(new Table(config, job.table, tableHash(job.table), verbosity, feeder))).first;
+            }
+            found->second->join(job.conn, job.text, out);
+        }else if(found == tables.end()){
+            return;
+        }else if(job.kind == JOB_COMMAND){
+            found->second->command(job.conn, job.text, out);
+        }else{
+            found->second->leave(job.conn, out);
+        }
+        //Closes the table once nobody is left at it
+        if(found->second->empty()){
+            tables.erase(found);
+        }
+    }
+    
+    void run(){
+        vector<TableMessage> out;
+        while(true){
+            TableJob job;
+            {
+                unique_lock<mutex> guard(lock);
+                ready.wait(guard, [this]{ return stop || !jobs.empty(); });
+                if(jobs.empty()){
+                    return;
+                }
+                job = move(jobs.front());
+                jobs.pop_front();
+            }
+            handle(job, out);
+            outbox.post(out);
+        }
+    }
+public:
+    Worker(const SimulationConfig& serverConfig, Verbosity v, Outbox& box, ShoeFeeder* shoeFeeder) : config(serverConfig), verbosity(v), outbox(box), feeder(shoeFeeder){
+        runner = thread(&Worker::run, this);
+    }
+    
+    ~Worker(){
+        {
+            lock_guard<mutex> guard(lock);
+            stop = true;
+        }
+        ready.notify_one();
+        runner.join();
+    }
+    
+    void post(TableJob job){
+        {
+            lock_guard<mutex> guard(lock);
+            jobs.push_back(move(job));
+        }
+        ready.notify_one();
+    }
+};
+
+//One client connection, only touched by the I/O thread
+struct Connection{
+    int fd;
+    string in; //Bytes read but not yet split into lines
+    string out; //Bytes waiting for the socket to take them
+    string table; //Table the connection sits at, empty if none
+    bool writeWaiting = false; //Registered for EPOLLOUT because out didn't fit in the socket
+};
+
+const char* const HELP_TEXT =
+    "Commands: JOIN TABLE NAME, DEAL, H (hit), S (stand), AI N, SCORES, LEAVE, QUIT\n";
+
+//Server class is the I/O thread: it accepts connections, splits what they send into lines, hands each line to the worker that owns the connection's table, and sends back whatever the workers produce
+class Server{
+private:
+    int epoll = -1;
+    int listener = -1;
+    string socketPath; //Unix socket this server bound, removed again when it shuts down. Empty for TCP
+    dev_t socketDevice = 0; //Identifies the socket file, so a file put at the path since isn't removed
+    ino_t socketInode = 0;
+    Outbox outbox;
+    unique_ptr<ShoeFeeder> feeder; //Declared before the workers so every table has closed before it stops
+    vector<unique_ptr<Worker>> workers;
+    unordered_map<uint64_t, Connection> conns;
+    uint64_t nextId = WAKE_ID + 1;
+    
+    Worker& workerFor(const string& table){
+        return *workers[tableHash(table) % workers.size()];
+    }
+    
+    void watch(int fd, uint64_t id, uint32_t events, int op){
+        epoll_event event{};
+        event.events = events;
+        event.data.u64 = id;
+        epoll_ctl(epoll, op, fd, &event);
+    }
+    
+    void close(uint64_t id){
+        auto found = conns.find(id);
+        if(found == conns.end()){
+            return;
+        }
+        Connection& conn = found->second;
+        if(!conn.table.empty()){
+            workerFor(conn.table).post({JOB_LEAVE, id, conn.table, ""});
+        }
+        epoll_ctl(epoll, EPOLL_CTL_DEL, conn.fd, nullptr);
+        ::close(conn.fd);
+        conns.erase(found);
+    }
+    
+    //Writes as much of the connection's output as the socket takes, and waits for EPOLLOUT if some is left. Returns false if the connection was closed
+    bool send(uint64_t id, Connection& conn){
+        while(!conn.out.empty()){
+            ssize_t sent = ::send(conn.fd, conn.out.data(), conn.out.size(), MSG_NOSIGNAL);
+            if(sent < 0){
+                if(errno == EAGAIN || errno == EWOULDBLOCK){
+                    break;
+                }
+                close(id);
+                return false;
+            }
+            conn.out.erase(0, sent);
+        }
+        if(conn.out.size() > MAX_PENDING_OUTPUT){
+            close(id);
+            return false;
+        }
+        bool waiting = !conn.out.empty();
+        if(waiting != conn.writeWaiting){
+            conn.writeWaiting = waiting;
+            watch(conn.fd, id, EPOLLIN | (waiting ? (uint32_t)EPOLLOUT : 0u), EPOLL_CTL_MOD);
+        }
+        return true;
+    }
+    
+    //Handles one command line. Connection-level commands are answered here; everything else goes to the table's worker. Returns false if the connection was closed
+    bool handleLine(uint64_t id, Connection& conn, const string& line){
+        string word, table, name;
+        size_t start = line.find_first_not_of(" \t");
+        if(start == string::npos){
+            return true;
+        }
+        word = line.substr(start, line.find_first_of(" \t", start) - start);
+        transform(word.begin(), word.end(), word.begin(), [](unsigned char c){ return toupper(c); });
+        
+        if(word == "QUIT"){
+            close(id);
+            return false;
+        }else if(word == "HELP"){
+            conn.out += HELP_TEXT;
+        }else if(word == "JOIN"){
+            if(!conn.table.empty()){
+                conn.out += "ERR already at table " + conn.table + "\n";
+                return send(id, conn);
+            }
+            size_t tableStart = line.find_first_not_of(" \t", start + word.size());
+            if(tableStart == string::npos){
+                conn.out += "ERR usage: JOIN TABLE NAME\n";
+                return send(id, conn);
+            }
+            size_t tableEnd = min(line.find_first_of(" \t", tableStart), line.size());
+            table = line.substr(tableStart, tableEnd - tableStart);
+            size_t nameStart = line.find_first_not_of(" \t", tableEnd);
+            name = nameStart == string::npos ? "Player" : line.substr(nameStart, 32);
+            conn.table = table;
+            workerFor(table).post({JOB_JOIN, id, table, name});
+        }else if(conn.table.empty()){
+            conn.out += "ERR join a table first: JOIN TABLE NAME\n";
+        }else if(word == "LEAVE"){
+            //The connection is free to join another table straight away; the table lets the seat go in its own time
+            workerFor(conn.table).post({JOB_LEAVE, id, conn.table, ""});
+            conn.out += "OK left " + conn.table + "\n";
+            conn.table.clear();
+        }else{
+            workerFor(conn.table).post({JOB_COMMAND, id, conn.table, line});
+        }
+        return send(id, conn);
+    }
+    
+    void accept(){
+        while(true){
+            int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if(fd < 0){
+                return;
+            }
+            uint64_t id = nextId++;
+            Connection& conn = conns[id];
+            conn.fd = fd;
+            watch(fd, id, EPOLLIN, EPOLL_CTL_ADD);
+            conn.out = "Welcome to 21. " + string(HELP_TEXT);
+            send(id, conn);
+        }
+    }
+    
+    //Reads one chunk per wake-up. The socket is watched level-triggered, so anything left is reported again, and a client that never stops sending can't hold the thread away from the other connections
+    void read(uint64_t id){
+        Connection& conn = conns[id];
+        char chunk[4096];
+        ssize_t got = recv(conn.fd, chunk, sizeof(chunk), 0);
+        if(got == 0 || (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK)){
+            close(id);
+            return;
+        }
+        if(got < 0){
+            return;
+        }
+        conn.in.append(chunk, got);
+        
+        //Runs every complete line
+        size_t lineStart = 0;
+        size_t newline;
+        while((newline = conn.in.find('\n', lineStart)) != string::npos){
+            size_t lineEnd = newline > lineStart && conn.in[newline - 1] == '\r' ? newline - 1 : newline;
+            if(!handleLine(id, conn, conn.in.substr(lineStart, lineEnd - lineStart))){
+                return;
+            }
+            lineStart = newline + 1;
+        }
+        conn.in.erase(0, lineStart);
+        if(conn.in.size() > MAX_LINE){
+            close(id);
+        }
+    }
+    
+    //Sends everything the workers have posted since the last wake-up
+    void deliver(){
+        uint64_t count;
+        ssize_t got = ::read(outbox.wake, &count, sizeof(count));
+        (void)got;
+        vector<TableMessage> messages;
+        {
+            lock_guard<mutex> guard(outbox.lock);
+            messages.swap(outbox.messages);
+        }
+        for(TableMessage& message : messages){
+            auto found = conns.find(message.conn);
+            if(found == conns.end()){
+                continue; //The connection hung up after the command was sent
+            }
+            //A refusal can arrive after the connection has left that table and joined another, so it only clears the table it came from
+            if(!message.detach.empty() && message.detach == found->second.table){
+                found->second.table.clear();
+            }
+            found->second.out += message.text;
+        }
+        //Sends once per connection, after all of its messages are queued
+        for(TableMessage& message : messages){
+            auto found = conns.find(message.conn);
+            if(found != conns.end() && !found->second.out.empty()){
+                send(message.conn, found->second);
+            }
+        }
+    }
+public:
+    ~Server(){
+        workers.clear(); //Finishes every worker before the outbox and connections go away
+        for(auto& entry : conns){
+            ::close(entry.second.fd);
+        }
+        if(listener >= 0){
+            ::close(listener);
+        }
+        struct stat info;
+        if(!socketPath.empty() && lstat(socketPath.c_str(), &info) == 0 && S_ISSOCK(info.st_mode) && info.st_dev == socketDevice && info.st_ino == socketInode){
+            unlink(socketPath.c_str());
+        }
+        if(outbox.wake >= 0){
+            ::close(outbox.wake);
+        }
+        if(epoll >= 0){
+            ::close(epoll);
+        }
+    }
+    
+    //Opens the listening socket and starts the workers. Returns false with a message if the address can't be used
+    bool start(const SimulationConfig& config, const string& address, int workerNum, Verbosity verbosity){
+        bool tcp = !address.empty() && all_of(address.begin(), address.end(), [](unsigned char c){ return isdigit(c); });
+        if(tcp){
+            int port = address.size() <= 5 ? atoi(address.c_str()) : 0;
+            if(port < 1 || port > 65535){
+                cout << "Port must be 1-65535: " << address << endl;
+                return false;
+            }
+            listener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if(listener < 0){
+                cout << "Can't open a socket: " << strerror(errno) << endl;
+                return false;
+            }
+            int on = 1;
+            setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if(bind(listener, (sockaddr*)&addr, sizeof(addr)) < 0){
+                cout << "Can't listen on port " << address << ": " << strerror(errno) << endl;
+                return false;
+            }
+        }else{
+            sockaddr_un addr{};
+            if(address.size() >= sizeof(addr.sun_path)){
+                cout << "Socket path is too long: " << address << endl;
+                return false;
+            }
+            listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if(listener < 0){
+                cout << "Can't open a socket: " << strerror(errno) << endl;
+                return false;
+            }
+            addr.sun_family = AF_UNIX;
+            strcpy(addr.sun_path, address.c_str());
+            //Clears a socket left behind by an earlier run, but never anything else that's at the path
+            struct stat info;
+            if(lstat(address.c_str(), &info) == 0){
+                if(!S_ISSOCK(info.st_mode)){
+                    cout << "Can't listen on " << address << ": there's already a file there that isn't a socket" << endl;
+                    return false;
+                }
+                unlink(address.c_str());
+            }
+            if(bind(listener, (sockaddr*)&addr, sizeof(addr)) < 0){
+                cout << "Can't listen on " << address << ": " << strerror(errno) << endl;
+                return false;
+            }
+            if(lstat(address.c_str(), &info) == 0){
+                socketPath = address;
+                socketDevice = info.st_dev;
+                socketInode = info.st_ino;
+            }
+        }
+        if(listen(listener, SOMAXCONN) < 0){
+            cout << "Can't listen on " << address << ": " << strerror(errno) << endl;
+            return false;
+        }
+        
+        epoll = epoll_create1(EPOLL_CLOEXEC);
+        if(epoll < 0){
+            cout << "Can't create an epoll instance: " << strerror(errno) << endl;
+            return false;
+        }
+        outbox.wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if(outbox.wake < 0){
+            cout << "Can't create the workers' wake-up eventfd: " << strerror(errno) << endl;
+            return false;
+        }
+        watch(listener, LISTEN_ID, EPOLLIN, EPOLL_CTL_ADD);
+        watch(outbox.wake, WAKE_ID, EPOLLIN, EPOLL_CTL_ADD);
+        if(config.preshuffle){
+            feeder.reset(new ShoeFeeder()); //Reshuffles are prepared off the workers, so the round that reaches the cut card doesn't wait on a shuffle
+        }
+        for(int i = 0; i < workerNum; i++){
+            workers.push_back(unique_ptr<Worker>(new Worker(config, verbosity, outbox, feeder.get())));
+        }
+        cout << "Serving tables on " << (tcp ? "127.0.0.1:" : "") << address << " with " << workerNum << " worker thread(s)" << endl;
+        return true;
+    }
+    
+    //Waits on every socket until a stop is requested
+    void run(){
+        epoll_event events[MAX_EVENTS];
+        while(!stopping){
+            int ready = epoll_wait(epoll, events, MAX_EVENTS, -1);
+            if(ready < 0){
+                if(errno == EINTR){
+                    continue;
+                }
+                break;
+            }
+            for(int i = 0; i < ready; i++){
+                uint64_t id = events[i].data.u64;
+                if(id == LISTEN_ID){
+                    accept();
+                }else if(id == WAKE_ID){
+                    deliver();
+                }else if(conns.count(id)){
+                    if(events[i].events & (EPOLLHUP | EPOLLERR)){
+                        close(id);
+                        continue;
+                    }
+                    if(events[i].events & EPOLLOUT){
+                        if(!send(id, conns[id])){
+                            continue;
+                        }
+                    }
+                    if(events[i].events & EPOLLIN){
+                        read(id);
+                    }
+                }
+            }
+        }
+    }
+};
+
+int runServer(const SimulationConfig& config, const string& address, int workerNum, Verbosity verbosity){
+    //Ctrl-C and SIGTERM stop the server between events. A client that hangs up mid-write mustn't kill the process
+    struct sigaction action{};
+    action.sa_handler = requestStop;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+    
+    int code = 0;
+    {
+        Server server;
+        if(server.start(config, address, workerNum, verbosity)){
+            server.run();
+        }else{
+            code = 1;
+        }
+    }
+    return code;
+}
+
+#else
+
+int runServer(const SimulationConfig& config, const string& address, int workerNum, Verbosity verbosity){
+    cout << "The game server needs Linux (epoll)" << endl;
+    return 1;
+}
+
+#endif
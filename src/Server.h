@@ -0,0 +1,13 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "Renderer.h"
+#include "Simulation.h"
+#include <string>
+
+//Runs the game server until it's stopped with Ctrl-C or SIGTERM. Returns the process exit code
+//address is a TCP port (listening on 127.0.0.1) or the path of a Unix socket. Every connection speaks a line protocol: JOIN TABLE NAME sits down at a table (opening it if needed), then the table's commands (see Table) play it, and QUIT hangs up
+//One thread waits on every socket at once and a pool of worker threads runs the tables. Each table always runs on the same worker, so its commands are handled in order without any locking, and an idle table costs a few kilobytes and no thread
+int runServer(const SimulationConfig& config, const std::string& address, int workerNum, Verbosity verbosity);
+
+#endif
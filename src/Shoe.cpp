@@ -0,0 +1,35 @@
+#include "Shoe.h"
+#include "Profile.h"
+#include <utility> //swap
+
+using namespace std;
+
+//Will shuffle the deck of cards randomizing the order from start to end (Fisher-Yates). Written out instead of using std::shuffle so the same seed gives the same order with every compiler and standard library
+void shuffleCards(vector<Card>& deck, Rng& rng){
+    for(int i = deck.size() - 1; i > 0; i--){
+        int j = rng.below(i + 1);
+        swap(deck[i], deck[j]);
+    }
+}
+
+void newDeckOrder(vector<Card>& cards){
+    for(size_t i = 0; i < cards.size(); i++){
+        cards[i] = Card(i % RANK_COUNT, (i / RANK_COUNT) % SUIT_COUNT);
+    }
+}
+
+void dealShoe(vector<Card>& cards, uint64_t seed, uint64_t stream, uint64_t shuffle){
+    newDeckOrder(cards);
+    Rng rng(seed, stream, shuffle);
+    shuffleCards(cards, rng);
+}
+
+//Checks before each round whether the cut card has come out, and if so reshuffles the shoe passed through by reference. Returns true if the shoe was reshuffled
+bool checkDeckSize(Shoe& shoe){
+    if (shoe.needsShuffle()) {
+        PROFILE_COUNT(COUNT_RESHUFFLE);
+        shoe.shuffle();
+        return true;
+    }
+    return false;
+}
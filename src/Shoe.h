@@ -0,0 +1,168 @@
+#ifndef SHOE_H
+#define SHOE_H
+
+#include "Card.h"
+#include "Rng.h"
+#include "ShoeFeeder.h"
+#include "ShoeTracker.h"
+#include <algorithm> //min, copy
+#include <utility> //swap
+#include <memory>
+#include <vector>
+
+//Will shuffle the deck of cards randomizing the order from start to end (Fisher-Yates). Written out instead of using std::shuffle so the same seed gives the same order with every compiler and standard library
+void shuffleCards(std::vector<Card>& deck, Rng& rng);
+
+//Puts the cards of a shoe in new-deck order and shuffles them for shuffle number shuffle of (seed, stream). Shuffle 0 is the shoe as it's started and every reshuffle counts up from there, so any shoe can be dealt again from those three numbers alone, on any thread
+void dealShoe(std::vector<Card>& cards, uint64_t seed, uint64_t stream, uint64_t shuffle);
+
+//Puts the cards of a shoe in new-deck order
+void newDeckOrder(std::vector<Card>& cards);
+
+//ShoeState struct is everything needed to put a shoe back where it was: its cards follow from the seed, the stream and the number of reshuffles, so only the cursor has to be kept besides
+struct ShoeState{
+    uint64_t seed = 0;
+    uint64_t stream = 0;
+    uint64_t shuffles = 0;
+    int64_t cursor = 0;
+};
+
+const int MAX_DECKS = 8; //Largest shoe a table can use
+const int ROUND_SHOE_CHUNK = 16; //Cards a round shoe shuffles to the top at a time
+
+//Shoe class holds 1-8 decks of cards that are dealt from the top by moving a cursor. The cards are allocated once and reshuffled in place once the cut card comes out, or swapped for a shoe a ShoeFeeder has already shuffled. It can also be started fresh for every round, for comparing strategies round by round
+class Shoe{
+private:
+    std::vector<Card> cards; //Every card in the shoe, dealt and undealt
+    int cursor = 0; //Index of the next card to deal
+    int end = 0; //Once the cursor reaches this index the cards after it have to be shuffled before the next draw: the end of the shoe, or of the part of a round shoe shuffled so far
+    int cutCard = 0; //Once the cursor reaches this index the shoe is reshuffled before the next round
+    uint64_t seed = 0;
+    uint64_t stream = 0;
+    uint64_t shuffles = 0; //Reshuffles since the shoe was started on (seed, stream)
+    std::shared_ptr<ShoeQueue> feed; //Shoes shuffled ahead by a ShoeFeeder, if one is attached
+    ShoeTracker tracker; //What has been dealt since the last shuffle
+    Rng roundRng; //Shuffles a round shoe a chunk at a time
+    std::vector<Card> ordered; //The shoe in new-deck order, kept once a round shoe has been started so each round starts from a copy
+    
+    //Shuffles the next chunk of a round shoe to the top (Fisher-Yates from the front), or reshuffles a shoe that has run dry
+    void refill(){
+        if(end == (int)cards.size()){
+            shuffle();
+            return;
+        }
+        int chunkEnd = std::min(end + ROUND_SHOE_CHUNK, (int)cards.size());
+        for(int i = end; i < chunkEnd; i++){
+            std::swap(cards[i], cards[i + roundRng.below(cards.size() - i)]);
+        }
+        end = chunkEnd;
+    }
+public:
+    //Builds the shoe from the given number of decks. Penetration is the fraction of the shoe dealt before the cut card comes out
+    Shoe(int decks, double penetration, uint64_t shoeSeed, uint64_t shoeStream = 0) : cards(decks * DECK_SIZE), seed(shoeSeed), stream(shoeStream), tracker(decks){
+        cutCard = (int)(cards.size() * penetration);
+        end = cards.size();
+        dealShoe(cards, seed, stream, 0);
+    }
+    
+    Shoe(Shoe&&) = default;
+    Shoe& operator=(Shoe&&) = default;
+    Shoe(const Shoe&) = delete; //Only one shoe may take from a feeder's queue
+    Shoe& operator=(const Shoe&) = delete;
+    
+    //Has feeder shuffle this shoe's reshuffles ahead of time on its thread. The cards dealt are the same with or without a feeder
+    void attach(ShoeFeeder& feeder){
+        feed = feeder.open(cards.size(), seed, stream, shuffles + 1);
+    }
+    
+    //Deals the top card. A round shoe shuffles its next few cards first when it needs them, and a shoe that runs completely dry in the middle of a round is reshuffled on the spot
+    Card draw(){
+        if(cursor == end){
+            refill();
+        }
+        Card card = cards[cursor++];
+        tracker.seen(card);
+        return card;
+    }
+    
+    //Returns true once the cut card has come out
+    bool needsShuffle(){
+        return cursor >= cutCard;
+    }
+    
+    //Puts every card back into the shoe and shuffles it, reusing the same memory. With a feeder attached this is usually just a swap with a shoe it has already shuffled
+    void shuffle(){
+        shuffles++;
+        if(!feed || !feed->take(seed, stream, shuffles, cards)){
+            dealShoe(cards, seed, stream, shuffles);
+        }
+        cursor = 0;
+        end = cards.size();
+        tracker.reset();
+    }
+    
+    //Restarts the shoe on a new seed and stream: puts the cards back in new-deck order and shuffles them, so the order only depends on (seed, stream) and not on earlier shuffles
+    void restart(uint64_t shoeSeed, uint64_t shoeStream){
+        seed = shoeSeed;
+        stream = shoeStream;
+        shuffles = 0;
+        dealShoe(cards, seed, stream, 0);
+        cursor = 0;
+        end = cards.size();
+        tracker.reset();
+        if(feed){
+            feed->restart(seed, stream);
+        }
+    }
+    
+    //Starts a fresh shoe for a single round: round number round of (shoeSeed, shoeStream). Only the cards the round actually deals get shuffled, a chunk at a time as they're needed, so starting a round costs a few random numbers instead of a whole shuffle
+    //Every shoe started on the same round deals the same cards in the same order, however many cards earlier rounds used, so strategies played on round shoes can be compared round by round
+    void startRound(uint64_t shoeSeed, uint64_t shoeStream, uint64_t round){
+        seed = shoeSeed;
+        stream = shoeStream;
+        shuffles = 0;
+        if(ordered.empty()){
+            ordered.resize(cards.size());
+            newDeckOrder(ordered);
+        }
+        std::copy(ordered.begin(), ordered.end(), cards.begin());
+        roundRng.reseed(seed, stream, round + 1); //Substream 0 is the stream itself
+        cursor = 0;
+        end = 0;
+        tracker.reset();
+    }
+    
+    //Returns where the shoe is, to resume it later
+    ShoeState getState() const{
+        return {seed, stream, shuffles, cursor};
+    }
+    
+    //Puts the shoe back where it was when state was taken: deals the same shuffle again and takes the cards already dealt out of the tracker. Call it before attaching a feeder
+    void resume(const ShoeState& state){
+        seed = state.seed;
+        stream = state.stream;
+        shuffles = state.shuffles;
+        dealShoe(cards, seed, stream, shuffles);
+        cursor = 0;
+        end = cards.size();
+        tracker.reset();
+        while(cursor < state.cursor && cursor < end){
+            tracker.seen(cards[cursor++]);
+        }
+    }
+    
+    //Returns the tracker of the cards dealt since the last shuffle: what's left of each rank and the Hi-Lo count
+    const ShoeTracker& getTracker() const{
+        return tracker;
+    }
+    
+    //Returns how many cards are left to deal
+    int cardsLeft(){
+        return cards.size() - cursor;
+    }
+};
+
+//Checks before each round whether the cut card has come out, and if so reshuffles the shoe passed through by reference. Returns true if the shoe was reshuffled
+bool checkDeckSize(Shoe& shoe);
+
+#endif
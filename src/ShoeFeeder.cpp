@@ -0,0 +1,77 @@
+#include "ShoeFeeder.h"
+#include "Shoe.h"
+
+using namespace std;
+
+bool ShoeQueue::fill(){
+    if(!hasFreeSlot()){
+        return false;
+    }
+    uint64_t last = tail.load(memory_order_relaxed);
+    Slot& slot = slots[last % FEED_SLOTS];
+    {
+        lock_guard<mutex> guard(planLock);
+        slot.seed = planSeed;
+        slot.stream = planStream;
+        slot.shuffle = planShuffle++;
+    }
+    dealShoe(slot.cards, slot.seed, slot.stream, slot.shuffle);
+    tail.store(last + 1, memory_order_release);
+    return true;
+}
+
+ShoeFeeder::ShoeFeeder(){
+    runner = thread(&ShoeFeeder::run, this);
+}
+
+ShoeFeeder::~ShoeFeeder(){
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    runner.join();
+}
+
+shared_ptr<ShoeQueue> ShoeFeeder::open(size_t cardCount, uint64_t seed, uint64_t stream, uint64_t shuffle){
+    shared_ptr<ShoeQueue> queue = make_shared<ShoeQueue>(cardCount, seed, stream, shuffle, &wake, &lock, &pending, &idle);
+    {
+        lock_guard<mutex> guard(lock);
+        queues.push_back(queue);
+        pending.store(true, memory_order_relaxed);
+    }
+    wake.notify_one();
+    return queue;
+}
+
+void ShoeFeeder::run(){
+    unique_lock<mutex> guard(lock);
+    while(!stopping){
+        //Cleared before the queues are looked at, so a slot freed during the pass sets it again and the feeder doesn't sleep on it
+        pending.exchange(false, memory_order_acq_rel);
+        for(size_t i = 0; i < queues.size();){
+            //Only the feeder still holds the queue once its shoe is gone, and nothing can hand it out again
+            if(queues[i].use_count() == 1){
+                queues[i] = move(queues.back());
+                queues.pop_back();
+                continue;
+            }
+            pass.push_back(queues[i]);
+            i++;
+        }
+        guard.unlock();
+        bool filled = false;
+        for(const shared_ptr<ShoeQueue>& queue : pass){
+            filled |= queue->fill();
+        }
+        pass.clear(); //Drops the pass's references before the next use_count check
+        guard.lock();
+        if(!filled){
+            //Shoes set pending and then wake the feeder once idle is set, so every slot freed from here on is either seen by the check or comes with a wake-up. A shoe that goes away doesn't wake it, and its queue is dropped on the next pass
+            idle.store(true, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            wake.wait(guard, [this]{ return stopping || pending.load(memory_order_acquire); });
+            idle.store(false, memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#ifndef SHOEFEEDER_H
+#define SHOEFEEDER_H
+
+#include "Card.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+const int FEED_SLOTS = 4; //Shuffled shoes prepared ahead for each shoe the feeder serves
+
+//ShoeQueue class is the ring of shuffled shoes the feeder thread prepares for one Shoe. The feeder is the only writer of tail and the shoe the only writer of head, so handing a shoe over needs no lock: the shoe swaps its card vector with the slot's and the feeder reuses the old cards for a later shuffle
+//Every slot is labelled with the (seed, stream, shuffle) it was dealt from, so a slot prepared for a shoe that has since restarted is simply skipped
+class ShoeQueue{
+private:
+    struct Slot{
+        uint64_t seed = 0;
+        uint64_t stream = 0;
+        uint64_t shuffle = 0;
+        std::vector<Card> cards;
+    };
+    
+    Slot slots[FEED_SLOTS];
+    std::atomic<uint64_t> head{0}; //Next slot the shoe takes
+    std::atomic<uint64_t> tail{0}; //Next slot the feeder fills
+    std::condition_variable* wake; //Feeder's wake-up, told when a slot frees up while it sleeps
+    std::mutex* wakeLock; //The mutex the feeder sleeps on
+    std::atomic<bool>* pending; //Set whenever a slot frees up, so the feeder can tell it has work without scanning every queue
+    const std::atomic<bool>* idle; //The feeder is going to sleep. Checked first so a shoe taking slots from a busy feeder never makes a system call
+    
+    //Flags the freed slot and wakes the feeder if it's asleep. The fence pairs with the one the feeder passes after setting idle: either the feeder sees pending set before it sleeps, or this sees idle set. Taking the feeder's mutex before notifying makes sure it's really waiting by then, since it holds the mutex from checking pending until it sleeps
+    void notify(){
+        pending->store(true, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(idle->load(std::memory_order_relaxed)){
+            {
+                std::lock_guard<std::mutex> guard(*wakeLock);
+            }
+            wake->notify_one();
+        }
+    }
+    
+    //What the feeder prepares next. Only touched once per prepared shoe, so a plain lock is cheap enough
+    std::mutex planLock;
+    uint64_t planSeed = 0;
+    uint64_t planStream = 0;
+    uint64_t planShuffle = 1;
+public:
+    ShoeQueue(size_t cardCount, uint64_t seed, uint64_t stream, uint64_t shuffle, std::condition_variable* feederWake, std::mutex* feederLock, std::atomic<bool>* feederPending, const std::atomic<bool>* feederIdle) : wake(feederWake), wakeLock(feederLock), pending(feederPending), idle(feederIdle), planSeed(seed), planStream(stream), planShuffle(shuffle){
+        for(int i = 0; i < FEED_SLOTS; i++){
+            slots[i].cards.resize(cardCount);
+        }
+    }
+    
+    //Shoe side: swaps cards with the prepared shoe for shuffle number shuffle of (seed, stream). Returns false if it isn't ready yet, and the shoe shuffles it itself
+    bool take(uint64_t seed, uint64_t stream, uint64_t shuffle, std::vector<Card>& cards){
+        uint64_t first = head.load(std::memory_order_relaxed);
+        uint64_t last = tail.load(std::memory_order_acquire);
+        bool found = false;
+        for(; first != last; first++){
+            Slot& slot = slots[first % FEED_SLOTS];
+            if(slot.seed == seed && slot.stream == stream){
+                if(slot.shuffle == shuffle){
+                    cards.swap(slot.cards);
+                    first++;
+                    found = true;
+                    break;
+                }
+                if(slot.shuffle > shuffle){
+                    break; //Prepared for a later shuffle of this shoe, so it's kept
+                }
+            }
+            //Anything else was prepared for a shoe that has since restarted
+        }
+        head.store(first, std::memory_order_release);
+        notify();
+        return found;
+    }
+    
+    //Shoe side: the shoe has restarted on (seed, stream), so the feeder starts again from its first reshuffle. Slots still holding the old shoe are dropped so the feeder can refill them at once
+    void restart(uint64_t seed, uint64_t stream){
+        {
+            std::lock_guard<std::mutex> guard(planLock);
+            planSeed = seed;
+            planStream = stream;
+            planShuffle = 1;
+        }
+        head.store(tail.load(std::memory_order_acquire), std::memory_order_release);
+        notify();
+    }
+    
+    //Feeder side: returns true if a slot is free to prepare a shoe in
+    bool hasFreeSlot() const{
+        return tail.load(std::memory_order_relaxed) - head.load(std::memory_order_acquire) < FEED_SLOTS;
+    }
+    
+    //Feeder side: prepares the next planned shoe if a slot is free. Returns true if it did
+    bool fill();
+};
+
+//ShoeFeeder class runs one background thread that shuffles shoes ahead of time for every shoe attached to it, so a reshuffle at the table is a swap of two vectors instead of a full shuffle
+//The feeder must outlive every shoe attached to it. Once a shoe goes away its queue is dropped by the feeder thread
+class ShoeFeeder{
+private:
+    std::mutex lock; //Guards queues and stopping. Only held to add or drop queues and to go to sleep, never while shuffling
+    std::condition_variable wake;
+    std::atomic<bool> pending{false}; //A slot has freed up or a queue has been opened since the feeder's last pass began
+    std::atomic<bool> idle{false}; //Set while the feeder thread checks pending one last time and sleeps with every queue full
+    std::vector<std::shared_ptr<ShoeQueue>> queues;
+    std::vector<std::shared_ptr<ShoeQueue>> pass; //The queues the current pass fills, copied from queues so opening a shoe never waits on a shuffle
+    bool stopping = false;
+    std::thread runner;
+    
+    //Fills one free slot of every queue per pass, so a busy shoe can't starve the others, and sleeps once every queue is full until a shoe takes a slot, restarts or is opened
+    void run();
+public:
+    ShoeFeeder();
+    ~ShoeFeeder();
+    
+    ShoeFeeder(const ShoeFeeder&) = delete;
+    ShoeFeeder& operator=(const ShoeFeeder&) = delete;
+    
+    //Opens a queue for a shoe of cardCount cards, starting with reshuffle number shuffle of (seed, stream)
+    std::shared_ptr<ShoeQueue> open(size_t cardCount, uint64_t seed, uint64_t stream, uint64_t shuffle);
+};
+
+#endif
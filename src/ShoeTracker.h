@@ -0,0 +1,81 @@
+#ifndef SHOETRACKER_H
+#define SHOETRACKER_H
+
+#include "Card.h"
+#include "DealerOdds.h"
+#include <cstdint>
+
+//Hi-Lo count value of each rank, indexed by the rank index: 2-6 count +1, 7-9 count 0, tens and aces count -1
+const int HI_LO_VALUES[RANK_COUNT] = {1, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1};
+
+const int DECK_SIZE = SUIT_COUNT * RANK_COUNT;
+
+//ShoeTracker class follows what has come out of a shoe since its last shuffle: the cards of each rank still left and the Hi-Lo running count. The shoe tells it about every card as it's dealt, so every question is answered without looking at the cards again
+//It sees every card the moment it leaves the shoe, the dealer's hole card included, so a seat that only wants what's been shown should read it between rounds
+class ShoeTracker{
+private:
+    uint16_t remaining[RANK_COUNT]; //Cards of each rank still in the shoe
+    int cardsLeft = 0;
+    int running = 0; //Hi-Lo running count
+    int decks = 1;
+public:
+    ShoeTracker(int shoeDecks = 1){
+        reset(shoeDecks);
+    }
+    
+    //Puts every card back, for a freshly shuffled shoe
+    void reset(int shoeDecks){
+        decks = shoeDecks;
+        for(int r = 0; r < RANK_COUNT; r++){
+            remaining[r] = SUIT_COUNT * decks;
+        }
+        cardsLeft = DECK_SIZE * decks;
+        running = 0;
+    }
+    
+    void reset(){
+        reset(decks);
+    }
+    
+    //Takes a dealt card out
+    void seen(Card card){
+        remaining[card.rank()]--;
+        cardsLeft--;
+        running += HI_LO_VALUES[card.rank()];
+    }
+    
+    //Returns the cards of a rank still in the shoe
+    int getRemaining(int rank) const{
+        return remaining[rank];
+    }
+    
+    int getCardsLeft() const{
+        return cardsLeft;
+    }
+    
+    int getRunningCount() const{
+        return running;
+    }
+    
+    //Returns the decks still to be dealt, at least half a deck so the true count stays sane at the very end of a shoe
+    double getDecksLeft() const{
+        double left = (double)cardsLeft / DECK_SIZE;
+        return left < 0.5 ? 0.5 : left;
+    }
+    
+    //Returns the running count per deck still to be dealt
+    double getTrueCount() const{
+        return running / getDecksLeft();
+    }
+    
+    //Returns the cards left grouped by value, the form DealerOdds works on
+    ShoeComposition getComposition() const{
+        ShoeComposition shoe;
+        for(int r = 0; r < RANK_COUNT; r++){
+            shoe.counts[valueIndex(r)] += remaining[r];
+        }
+        return shoe;
+    }
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include "Simulation.h"
+#include "Checkpoint.h"
+#include "ShoeFeeder.h"
+#include "Stats.h"
+#include <algorithm>
+#include <cmath>
+#include <functional> //ref() to pass each worker its result slot
+#include <iomanip> //setprecision for printing simulation rates
+#include <iostream>
+#include <thread> //Worker threads for the simulation
+
+using namespace std;
+
+uint8_t logRuleFlags(const SimulationConfig& config){
+    return (config.hitSoft17 ? LOG_HIT_SOFT_17 : 0) | (config.sixToFive ? LOG_SIX_TO_FIVE : 0) | (config.canDouble ? LOG_CAN_DOUBLE : 0) | (config.canSplit ? LOG_CAN_SPLIT : 0);
+}
+
+//Plays blocks [firstBlock, endBlock) with the worker's own shoe, dealer, copy of the AI seats and seat table, so every thread owns its counters. With Logging each block is appended to logFile as soon as it's done. With a feeder the shoe's reshuffles are prepared on the feeder's thread
+//After every block the worker publishes its statistics to the monitor as worker number worker, and stops early if the monitor asks it to. With a checkpoint it also saves its progress in slot worker after every block, and starts from the block after the last one saved
+template<class R, bool Logging>
+static void simulateWorker(const SimulationConfig& config, long long firstBlock, long long endBlock, vector<AI> bot, SeatTable& table, LogFile* logFile, ShoeFeeder* feeder, StatsMonitor& monitor, int worker, Checkpoint* checkpoint){
+    Dealer dealer;
+    RoundLog log(logFile); //Only used with Logging. Holds one block of events at a time, so every block lands in the file in one piece
+    RoundStats stats;
+    Shoe shoe(config.decks, config.penetration, config.seed); //Allocated once per thread; every block restarts it in place
+    if(feeder){
+        shoe.attach(*feeder);
+    }
+    
+    //Every block is played from its own seed, so the blocks left play out exactly as they would have without the restart
+    CheckpointProgress progress;
+    if(checkpoint && checkpoint->load(worker, progress, table)){
+        firstBlock = progress.nextBlock;
+        stats = progress.stats;
+        monitor.publish(worker, stats);
+    }
+    
+    for(long long block = firstBlock; block < endBlock; block++){
+        shoe.restart(config.seed, block); //The block number is the shoe's random stream
+        long long blockEnd = min((block + 1) * ROUNDS_PER_BLOCK, config.rounds);
+        if constexpr(Logging){
+            log.block(block);
+        }
+        
+        for(long long r = block * ROUNDS_PER_BLOCK; r < blockEnd; r++){
+            playHeadlessRound<R, Logging>(shoe, dealer, bot, table, &log);
+            stats.addRound(table, dealer);
+        }
+        
+        if constexpr(Logging){
+            log.flush();
+        }
+        stats.endBlock();
+        stats.takeOutcomes(table);
+        monitor.publish(worker, stats);
+        if(checkpoint){
+            progress.nextBlock = block + 1;
+            progress.stats = stats;
+            checkpoint->save(worker, progress, table);
+        }
+        if(monitor.stopRequested()){
+            break;
+        }
+    }
+}
+
+//Runs the workers for the rule set R and adds their counters into table
+template<class R>
+static void runWorkers(const SimulationConfig& config, SeatTable& table, LogFile* logFile, ShoeFeeder* feeder, StatsMonitor& monitor, Checkpoint* checkpoint){
+    int aiNum = config.aiNum;
+    long long rounds = config.rounds;
+    vector<AI> bot(aiNum, AI(BASIC_STRATEGY, config.countSpread)); //Each worker plays a copy of the AI seats
+    
+    long long blocks = (rounds + ROUNDS_PER_BLOCK - 1) / ROUNDS_PER_BLOCK;
+    int threadNum = config.threadNum;
+    if(threadNum > blocks){
+        threadNum = blocks;
+    }
+    
+    //Every thread gets an equal, contiguous range of blocks. Since each block is seeded by its block number, the totals are the same for any thread count
+    vector<SeatTable> results(threadNum, SeatTable(aiNum));
+    vector<thread> workers;
+    for(int t = 0; t < threadNum; t++){
+        long long firstBlock = blocks * t / threadNum;
+        long long endBlock = blocks * (t + 1) / threadNum;
+        auto worker = logFile ? simulateWorker<R, true> : simulateWorker<R, false>;
+        workers.push_back(thread(worker, cref(config), firstBlock, endBlock, bot, ref(results[t]), logFile, feeder, ref(monitor), t, checkpoint));
+    }
+    for(int t = 0; t < threadNum; t++){
+        workers[t].join();
+    }
+    
+    //Adds up every thread's counters for each seat
+    for(int t = 0; t < threadNum; t++){
+        table.merge(results[t]);
+    }
+}
+
+//Turns the rule flags in the config into template arguments one at a time, so each of the 16 rule sets runs its own compiled round loop and the loop itself never checks a rule
+template<bool... Fixed>
+static void dispatchRules(const SimulationConfig& config, SeatTable& table, LogFile* logFile, ShoeFeeder* feeder, StatsMonitor& monitor, Checkpoint* checkpoint){
+    constexpr size_t fixedNum = sizeof...(Fixed);
+    if constexpr(fixedNum == 4){
+        runWorkers<Rules<Fixed...>>(config, table, logFile, feeder, monitor, checkpoint);
+    }else{
+        const bool flags[4] = {config.hitSoft17, config.sixToFive, config.canDouble, config.canSplit};
+        if(flags[fixedNum]){
+            dispatchRules<Fixed..., true>(config, table, logFile, feeder, monitor, checkpoint);
+        }else{
+            dispatchRules<Fixed..., false>(config, table, logFile, feeder, monitor, checkpoint);
+        }
+    }
+}
+
+void simulateRounds(const SimulationConfig& requested){
+    SimulationConfig config = requested;
+    long long blocks = (config.rounds + ROUNDS_PER_BLOCK - 1) / ROUNDS_PER_BLOCK;
+    config.threadNum = min((long long)config.threadNum, blocks); //Fixed here so a checkpoint has one slot per thread that actually plays
+    
+    //A checkpoint left by an earlier run of the simulation is resumed with the settings it was started with, on the same threads, so every thread picks up its own range of blocks. Any other file that's already there is left alone unless it's to be overwritten
+    Checkpoint checkpoint;
+    if(!config.checkpointPath.empty()){
+        if(!config.overwriteCheckpoint && checkpoint.resume(config.checkpointPath, CHECKPOINT_SIMULATION)){
+            restoreSettings(checkpoint.header(), config);
+            config.threadNum = checkpoint.header().slots;
+            cout << "Resuming the simulation in " << config.checkpointPath << " (" << config.rounds << " rounds, seed " << config.seed << ", " << config.threadNum << " threads)" << endl;
+        }else if(!config.overwriteCheckpoint && !Checkpoint::isFree(config.checkpointPath)){
+            cout << config.checkpointPath << " isn't a checkpoint of this simulation. Not overwriting it without --overwrite-checkpoint" << endl;
+            return;
+        }else if(!checkpoint.create(config.checkpointPath, makeCheckpointHeader(CHECKPOINT_SIMULATION, config, config.aiNum, 0, config.threadNum), config.overwriteCheckpoint)){
+            cout << "Can't checkpoint to " << config.checkpointPath << endl;
+            return;
+        }
+    }
+    
+    int aiNum = config.aiNum;
+    SeatTable table(aiNum);
+    
+    //Every block is logged with its block number, so the log only needs the seed and table once at the start
+    LogFile logFile;
+    if(!config.logPath.empty()){
+        if(aiNum > MAX_LOG_SEATS || !logFile.open(config.logPath)){
+            cout << "Can't log to " << config.logPath << endl;
+            return;
+        }
+        RoundLog header(&logFile);
+        header.table(config.seed, config.decks, aiNum, logRuleFlags(config));
+        if(!header.flush()){
+            cout << "Can't write to " << config.logPath << endl;
+            return;
+        }
+    }
+    //One feeder thread shuffles ahead for every worker's shoe. The shoes deal the same cards either way, so it only changes the speed. On a single core it would only take turns with the worker, so it's left out
+    unique_ptr<ShoeFeeder> feeder(config.preshuffle && thread::hardware_concurrency() > 1 ? new ShoeFeeder() : nullptr);
+    //The monitor follows the workers' statistics while they play, writes the snapshots and stops them early once the interval is narrow enough
+    StatsMonitor monitor(max(config.threadNum, 1), config.statsPath, config.targetWidth);
+    monitor.start();
+    dispatchRules<>(config, table, config.logPath.empty() ? nullptr : &logFile, feeder.get(), monitor, checkpoint.isOpen() ? &checkpoint : nullptr);
+    RoundStats stats = monitor.finish();
+    if(logFile.hasFailed()){
+        cout << "Writing to " << config.logPath << " failed, so the log stops at the last block written before that" << endl;
+    }
+    long long rounds = stats.rounds; //Fewer than asked for if the simulation stopped early
+    
+    //Prints the rate of each outcome per hand played and the net result per round (in bets) for every AI seat and for all seats combined
+    long long totalWins = 0, totalLosses = 0, totalTies = 0, totalHands = 0, totalNet = 0;
+    cout << fixed << setprecision(4);
+    for(int i = 0; i < aiNum; i++){
+        double hands = table.getHands(i);
+        cout << "AI " << i + 1 << ": win " << table.getWins(i) / hands << "  loss " << table.getLosses(i) / hands << "  tie " << table.getTies(i) / hands << "  net " << showpos << table.getNet(i) / ((double)rounds * BET_UNIT) << noshowpos << "\n";
+        totalWins += table.getWins(i);
+        totalLosses += table.getLosses(i);
+        totalTies += table.getTies(i);
+        totalHands += table.getHands(i);
+        totalNet += table.getNet(i);
+    }
+    double hands = totalHands;
+    if(config.countSpread > 0){
+        cout << "The AIs count with Hi-Lo and bet 1-" << config.countSpread << " bets, so the net is per round and not per bet\n";
+    }
+    cout << "All AIs (" << rounds << " rounds, seed " << config.seed << "): win " << totalWins / hands << "  loss " << totalLosses / hands << "  tie " << totalTies / hands << "  net " << showpos << totalNet / ((double)rounds * aiNum * BET_UNIT) << noshowpos << "\n";
+    cout << "Net per round: " << showpos << stats.roundNet.mean << noshowpos << " +/- " << stats.roundNet.halfWidth() << " bets (95% confidence, sd " << sqrt(stats.roundNet.variance()) << ")" << endl;
+    if(rounds < config.rounds){
+        cout << "Stopped early: the interval was within +/- " << config.targetWidth << " bets after " << rounds << " of " << config.rounds << " rounds" << endl;
+    }
+}
@@ -0,0 +1,131 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "AI.h"
+#include "Dealer.h"
+#include "Profile.h"
+#include "RoundLog.h"
+#include "Rules.h"
+#include "SeatTable.h"
+#include "Shoe.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//Settings for a headless simulation, filled in from the command line
+struct SimulationConfig{
+    long long rounds = 0; //Number of rounds to play, 0 means play the interactive game
+    long long gameRounds = 0; //Rounds the interactive game plays before stopping, 0 means ask after every round
+    int aiNum = 1; //Number of AI seats
+    int threadNum = 1; //Number of worker threads
+    unsigned long long seed = 0; //Seed every shoe is shuffled from
+    int decks = 1; //Number of decks in the shoe
+    double penetration = 0.75; //Fraction of the shoe dealt before reshuffling
+    bool hitSoft17 = false; //Dealer hits soft 17
+    bool sixToFive = false; //Blackjack pays 6:5 instead of 3:2
+    bool canDouble = true; //Seats may double down
+    bool canSplit = true; //Seats may split pairs
+    std::string logPath; //Binary round log every round is appended to, empty for none
+    bool preshuffle = true; //Shuffle shoes ahead of time on a background thread
+    int countSpread = 0; //Largest bet of AI seats that count cards, 0 for AI seats that don't count
+    std::string statsPath; //File the running statistics are written to while the simulation runs, empty for none
+    double targetWidth = 0; //Stop the simulation early once the 95% interval of the net per round is this narrow, in bets. 0 plays every round
+    std::string checkpointPath; //Memory-mapped file the session's progress is kept in, so a restarted run picks up where it stopped. Empty for none
+    bool overwriteCheckpoint = false; //Start a new session in checkpointPath even if the file is already there, instead of resuming it or refusing to touch it
+    long long optimizeRounds = 0; //Rounds the best strategies play at the end of a strategy search, 0 for no search
+};
+
+//Returns the rule flags of the config as stored in a round log
+uint8_t logRuleFlags(const SimulationConfig& config);
+
+//Rounds are handed to threads in blocks. Each block starts a freshly shuffled shoe on its own random stream (the block number), so results don't depend on which thread plays it and any block can be replayed from (seed, block) alone
+const long long ROUNDS_PER_BLOCK = 1024;
+
+//Logs a headless round that has just been played, event by event in the order the cards came out of the shoe
+template<class R>
+void logHeadlessRound(RoundLog& log, Dealer& dealer, std::vector<AI>& bot, SeatTable& table, bool dealerNatural){
+    int aiNum = bot.size();
+    log.round();
+    for(int i = 0; i < aiNum; i++){
+        //A split hand's opening cards are the first card of each hand
+        Card second = bot[i].isSplit() ? bot[i].getSplitHand().card(0) : bot[i].getHand().card(1);
+        log.opening(i, bot[i].getHand().card(0), second);
+    }
+    const Hand& dealerHand = dealer.getHand();
+    log.opening(DEALER_SEAT, dealerHand.card(0), dealerHand.card(1));
+    log.dealerTurn(dealerHand);
+    if(!dealerNatural){
+        for(int i = 0; i < aiNum; i++){
+            if(bot[i].isSplit()){
+                log.splitTurn(i, bot[i].getHand(), bot[i].getStake() > bot[i].getBet(), bot[i].getSplitHand(), bot[i].getSplitStake() > bot[i].getBet());
+            }else{
+                log.turn(i, bot[i].getHand(), bot[i].getStake() > bot[i].getBet());
+            }
+        }
+    }
+    for(int i = 0; i < aiNum; i++){
+        log.result(i, table.getResult(i), table.getPayout(i));
+    }
+}
+
+//Plays one headless round under the rule set R: the same round as the interactive game (two cards to each AI and the dealer, the dealer plays, then the AIs play) and settles it in the seat table, where AI i is seat i. If the dealer has a natural the AIs don't get to play. With Logging the round is also written to log; without it the logging isn't compiled in at all
+template<class R, bool Logging = false>
+void playHeadlessRound(Shoe& shoe, Dealer& dealer, std::vector<AI>& bot, SeatTable& table, RoundLog* log = nullptr){
+    int aiNum = bot.size();
+    PROFILE_ROUND(timer);
+    bool shuffled = checkDeckSize(shoe);
+    if constexpr(Logging){
+        if(shuffled){
+            log->shuffle();
+        }
+    }
+    PROFILE_LAP(timer, PHASE_SHUFFLE);
+    
+    //Every AI bets before the first card is dealt, so a counting AI bets on what came out in earlier rounds
+    for(int i = 0; i < aiNum; i++){
+        bot[i].resetHand();
+        bot[i].placeBet(shoe.getTracker());
+    }
+    for(int i = 0; i < aiNum; i++){
+        bot[i].addCard(shoe);
+        bot[i].addCard(shoe);
+    }
+    
+    dealer.resetHand();
+    dealer.addCard(shoe);
+    dealer.addCard(shoe);
+    bool dealerNatural = dealer.hasBlackjack();
+    PROFILE_LAP(timer, PHASE_DEAL);
+    dealer.template play<R::HIT_SOFT_17>(shoe);
+    PROFILE_LAP(timer, PHASE_DEALER);
+    
+    if(!dealerNatural){
+        for(int i = 0; i < aiNum; i++){
+            bot[i].template play<R>(shoe, dealer.getUpcard());
+        }
+    }
+    PROFILE_LAP(timer, PHASE_AI);
+    
+    //Records every AI's hand in the seat table and settles them all against the dealer in one pass
+    for(int i = 0; i < aiNum; i++){
+        if constexpr(R::CAN_SPLIT){
+            if(bot[i].isSplit()){
+                table.recordSplit(i, bot[i].getHand(), bot[i].getStake(), bot[i].getSplitHand(), bot[i].getSplitStake());
+                continue;
+            }
+        }
+        table.record(i, bot[i].getHand(), bot[i].getStake());
+    }
+    table.settle(dealer.getTotal(), dealerNatural, R::BLACKJACK_PAY);
+    
+    if constexpr(Logging){
+        logHeadlessRound<R>(*log, dealer, bot, table, dealerNatural);
+    }
+    PROFILE_LAP(timer, PHASE_SETTLE);
+    PROFILE_FINISH(timer);
+}
+
+//Plays the configured number of rounds with only AI seats and the dealer, split across threads, without printing any cards or asking for input, then prints the win/loss/tie rates and the net result per round. The rule flags in the config pick which compiled rule set is played
+void simulateRounds(const SimulationConfig& config);
+
+#endif
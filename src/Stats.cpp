@@ -0,0 +1,171 @@
+#include "Stats.h"
+#include <chrono>
+#include <cstdio> //rename
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+//Names of the dealer upcards by value index, used as keys in the snapshots
+static const char* const UPCARD_NAMES[VALUE_COUNT] = {"2", "3", "4", "5", "6", "7", "8", "9", "10", "A"};
+
+//Names of the dealer's final totals, by DealerFinal
+static const char* const FINAL_NAMES[FINAL_COUNT] = {"17", "18", "19", "20", "21", "bust"};
+
+static double now(){
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//Returns part / whole, or 0 before anything has been counted
+static double rate(long long part, long long whole){
+    return whole ? (double)part / whole : 0;
+}
+
+void RoundStats::merge(const RoundStats& other){
+    rounds += other.rounds;
+    hands += other.hands;
+    wins += other.wins;
+    losses += other.losses;
+    ties += other.ties;
+    net += other.net;
+    roundNet.merge(other.roundNet);
+    for(int i = 0; i < FINAL_COUNT; i++){
+        dealerFinals[i] += other.dealerFinals[i];
+    }
+    for(int i = 0; i < VALUE_COUNT; i++){
+        upcardRounds[i] += other.upcardRounds[i];
+        upcardBusts[i] += other.upcardBusts[i];
+    }
+    for(int i = 0; i < SEAT_TOTAL_BUCKETS; i++){
+        seatTotals[i] += other.seatTotals[i];
+    }
+}
+
+StatsMonitor::StatsMonitor(int workers, const string& snapshotPath, double target) : path(snapshotPath), targetWidth(target), startTime(now()){
+    for(int i = 0; i < workers; i++){
+        slots.push_back(unique_ptr<Published<RoundStats>>(new Published<RoundStats>()));
+    }
+}
+
+StatsMonitor::~StatsMonitor(){
+    {
+        lock_guard<mutex> guard(lock);
+        finished = true;
+    }
+    done.notify_one();
+    if(runner.joinable()){
+        runner.join();
+    }
+}
+
+void StatsMonitor::start(){
+    if(!path.empty()){
+        ofstream(path, ios::trunc); //Every run starts its own snapshot file
+    }
+    if(!path.empty() || targetWidth > 0){
+        runner = thread(&StatsMonitor::run, this);
+    }
+}
+
+RoundStats StatsMonitor::merged() const{
+    RoundStats stats;
+    for(const auto& slot : slots){
+        stats.merge(slot->read());
+    }
+    return stats;
+}
+
+void StatsMonitor::run(){
+    unique_lock<mutex> guard(lock);
+    while(!finished){
+        done.wait_for(guard, chrono::milliseconds(STATS_PERIOD_MS));
+        if(finished){
+            break;
+        }
+        RoundStats stats = merged();
+        if(!path.empty()){
+            write(stats, now() - startTime);
+        }
+        if(targetWidth > 0 && stats.roundNet.n >= MIN_STOP_ROUNDS && stats.roundNet.halfWidth() <= targetWidth){
+            stopping.store(true, memory_order_relaxed);
+        }
+    }
+}
+
+RoundStats StatsMonitor::finish(){
+    {
+        lock_guard<mutex> guard(lock);
+        finished = true;
+    }
+    done.notify_one();
+    if(runner.joinable()){
+        runner.join();
+    }
+    RoundStats stats = merged();
+    if(!path.empty()){
+        write(stats, now() - startTime);
+    }
+    return stats;
+}
+
+void StatsMonitor::write(const RoundStats& stats, double seconds){
+    double width = stats.roundNet.n > 1 ? stats.roundNet.halfWidth() : 0;
+    bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+    
+    if(!json){
+        //One CSV row per snapshot, so the file shows how the results converged over the run
+        ofstream out(path, ios::app);
+        if(out.tellp() == 0){
+            out << "seconds,rounds,hands,win,loss,tie,net_per_round,net_sd,net_ci95";
+            for(int i = 0; i < VALUE_COUNT; i++){
+                out << ",dealer_bust_" << UPCARD_NAMES[i];
+            }
+            for(int i = 0; i < FINAL_COUNT; i++){
+                out << ",dealer_" << FINAL_NAMES[i];
+            }
+            out << "\n";
+        }
+        out << setprecision(6) << seconds << "," << stats.rounds << "," << stats.hands << "," << rate(stats.wins, stats.hands) << "," << rate(stats.losses, stats.hands) << "," << rate(stats.ties, stats.hands) << "," << stats.roundNet.mean << "," << sqrt(stats.roundNet.variance()) << "," << width;
+        for(int i = 0; i < VALUE_COUNT; i++){
+            out << "," << rate(stats.upcardBusts[i], stats.upcardRounds[i]);
+        }
+        for(int i = 0; i < FINAL_COUNT; i++){
+            out << "," << rate(stats.dealerFinals[i], stats.rounds);
+        }
+        out << "\n";
+        return;
+    }
+    
+    //The latest snapshot as one JSON object, written next to the file and renamed over it so a reader never sees half of it
+    string temp = path + ".tmp";
+    {
+        ofstream out(temp);
+        out << setprecision(6);
+        out << "{\n  \"seconds\": " << seconds << ",\n  \"rounds\": " << stats.rounds << ",\n  \"hands\": " << stats.hands << ",\n";
+        out << "  \"outcomes\": {\"win\": " << rate(stats.wins, stats.hands) << ", \"loss\": " << rate(stats.losses, stats.hands) << ", \"tie\": " << rate(stats.ties, stats.hands) << "},\n";
+        out << "  \"net_per_round\": {\"mean\": " << stats.roundNet.mean << ", \"sd\": " << sqrt(stats.roundNet.variance()) << ", \"ci95\": [" << stats.roundNet.mean - width << ", " << stats.roundNet.mean + width << "]},\n";
+        out << "  \"dealer_bust_by_upcard\": {";
+        for(int i = 0; i < VALUE_COUNT; i++){
+            out << (i ? ", " : "") << "\"" << UPCARD_NAMES[i] << "\": " << rate(stats.upcardBusts[i], stats.upcardRounds[i]);
+        }
+        out << "},\n  \"dealer_finals\": {";
+        for(int i = 0; i < FINAL_COUNT; i++){
+            out << (i ? ", " : "") << "\"" << FINAL_NAMES[i] << "\": " << rate(stats.dealerFinals[i], stats.rounds);
+        }
+        out << "},\n  \"seat_totals\": {";
+        long long seatHands = 0;
+        for(int i = 0; i < SEAT_TOTAL_BUCKETS; i++){
+            seatHands += stats.seatTotals[i];
+        }
+        bool first = true;
+        for(int i = 0; i < SEAT_TOTAL_BUCKETS; i++){
+            if(stats.seatTotals[i] == 0){
+                continue;
+            }
+            out << (first ? "" : ", ") << "\"" << (i == SEAT_TOTAL_BUCKETS - 1 ? string("bust") : to_string(i)) << "\": " << rate(stats.seatTotals[i], seatHands);
+            first = false;
+        }
+        out << "}\n}\n";
+    }
+    rename(temp.c_str(), path.c_str());
+}
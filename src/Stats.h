@@ -0,0 +1,212 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "Dealer.h"
+#include "DealerOdds.h"
+#include "SeatTable.h"
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+const int SEAT_TOTAL_BUCKETS = 23; //Final seat totals 0-21, and one bucket for busted hands
+const double Z_95 = 1.959964; //Normal quantile of a two-sided 95% confidence interval
+const long long MIN_STOP_ROUNDS = 100000; //Rounds a simulation plays before it may stop early, so the interval it stops on can be trusted
+const int STATS_PERIOD_MS = 250; //How often the monitor merges the workers' counts
+
+//Welford struct keeps a running mean and sum of squared deviations, which stays accurate over billions of samples where summing squares wouldn't
+struct Welford{
+    long long n = 0;
+    double mean = 0;
+    double m2 = 0;
+    
+    void add(double x){
+        n++;
+        double delta = x - mean;
+        mean += delta / n;
+        m2 += delta * (x - mean);
+    }
+    
+    //Adds another accumulator's samples (Chan's parallel formula), so threads can each keep their own
+    void merge(const Welford& other){
+        if(other.n == 0){
+            return;
+        }
+        long long total = n + other.n;
+        double delta = other.mean - mean;
+        mean += delta * other.n / total;
+        m2 += other.m2 + delta * delta * ((double)n * other.n / total);
+        n = total;
+    }
+    
+    double variance() const{
+        return n > 1 ? m2 / (n - 1) : 0;
+    }
+    
+    //Half-width of the 95% confidence interval of the mean
+    double halfWidth() const{
+        return n > 1 ? Z_95 * std::sqrt(variance() / n) : INFINITY;
+    }
+};
+
+//RoundStats struct holds everything one simulation thread has counted. It's plain data, so it can be copied word by word into a Published slot
+struct RoundStats{
+    long long rounds = 0;
+    long long hands = 0; //Hands played by every seat, a split counting as two
+    long long wins = 0;
+    long long losses = 0;
+    long long ties = 0;
+    long long net = 0; //Tenths of a bet
+    Welford roundNet; //Net result of each round per seat, in bets
+    long long dealerFinals[FINAL_COUNT] = {}; //How the dealer's hand finished, a natural counting as 21
+    long long upcardRounds[VALUE_COUNT] = {}; //Rounds played against each dealer upcard (by value index)
+    long long upcardBusts[VALUE_COUNT] = {}; //Of those, rounds the dealer busted
+    long long seatTotals[SEAT_TOTAL_BUCKETS] = {}; //Final total of every seat's main hand
+    int seats = 1;
+    long long blockRounds = 0; //Rounds not yet added to roundNet, summed exactly in tenths of a bet so a round costs no division
+    long long blockSum = 0;
+    long long blockSquares = 0;
+    
+    //Counts a settled round of the seat table against the dealer
+    void addRound(const SeatTable& table, Dealer& dealer){
+        seats = table.size();
+        long long roundPayout = 0;
+        for(int i = 0; i < seats; i++){
+            roundPayout += table.getPayout(i);
+            seatTotals[table.isBust(i) ? SEAT_TOTAL_BUCKETS - 1 : table.getTotal(i)]++;
+        }
+        blockRounds++;
+        blockSum += roundPayout;
+        blockSquares += roundPayout * roundPayout;
+        
+        int upcard = valueIndex(dealer.getUpcard().rank());
+        bool busted = dealer.checkBust();
+        upcardRounds[upcard]++;
+        upcardBusts[upcard] += busted;
+        dealerFinals[busted ? FINAL_BUST : dealer.getTotal() - 17]++;
+        rounds++;
+    }
+    
+    //Adds the rounds summed since the last call to roundNet, as one batch with its exact mean and spread
+    void endBlock(){
+        if(blockRounds == 0){
+            return;
+        }
+        double scale = (double)seats * BET_UNIT;
+        Welford block;
+        block.n = blockRounds;
+        block.mean = (double)blockSum / blockRounds / scale;
+        block.m2 = (blockSquares - (double)blockSum * blockSum / blockRounds) / (scale * scale);
+        roundNet.merge(block);
+        blockRounds = blockSum = blockSquares = 0;
+    }
+    
+    //Copies the seat table's outcome counters, which it keeps over every round the thread has played
+    void takeOutcomes(const SeatTable& table){
+        hands = wins = losses = ties = net = 0;
+        for(int i = 0; i < table.size(); i++){
+            hands += table.getHands(i);
+            wins += table.getWins(i);
+            losses += table.getLosses(i);
+            ties += table.getTies(i);
+            net += table.getNet(i);
+        }
+    }
+    
+    void merge(const RoundStats& other);
+};
+
+//Published class hands a copy of a plain value from one writer thread to any number of readers without a lock (a seqlock). The writer never waits; a reader that catches a copy half-written just reads it again
+//The value is kept as atomic words so a torn read is never undefined behaviour, only a retry
+template<class T>
+class Published{
+private:
+    static const size_t WORDS = (sizeof(T) + 7) / 8;
+    std::atomic<uint32_t> sequence{0}; //Odd while a copy is being written
+    std::atomic<uint64_t> words[WORDS] = {};
+public:
+    void publish(const T& value){
+        uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        uint32_t s = sequence.load(std::memory_order_relaxed);
+        sequence.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for(size_t i = 0; i < WORDS; i++){
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence.store(s + 2, std::memory_order_release);
+    }
+    
+    T read() const{
+        uint64_t buffer[WORDS];
+        while(true){
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if(before & 1){
+                std::this_thread::yield();
+                continue;
+            }
+            for(size_t i = 0; i < WORDS; i++){
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(sequence.load(std::memory_order_relaxed) == before){
+                break;
+            }
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+};
+
+//StatsMonitor class collects the statistics of a simulation while it runs. Every worker thread publishes its own RoundStats after each block; a monitor thread merges them a few times a second, writes a snapshot, and asks the workers to stop once the net result per round is known closely enough
+class StatsMonitor{
+private:
+    std::vector<std::unique_ptr<Published<RoundStats>>> slots; //One per worker
+    std::string path; //Snapshot file: JSON if it ends in .json, CSV rows otherwise. Empty for none
+    double targetWidth; //Stop once the 95% interval of the net per round is this narrow (half-width, in bets). 0 to always play every round
+    std::atomic<bool> stopping{false};
+    std::mutex lock;
+    std::condition_variable done;
+    bool finished = false;
+    std::thread runner;
+    double startTime;
+    
+    //Writes one snapshot to the file
+    void write(const RoundStats& stats, double seconds);
+    
+    void run();
+public:
+    StatsMonitor(int workers, const std::string& snapshotPath, double target);
+    ~StatsMonitor();
+    
+    StatsMonitor(const StatsMonitor&) = delete;
+    StatsMonitor& operator=(const StatsMonitor&) = delete;
+    
+    //Starts the monitor thread if there are snapshots to write or an interval to wait for
+    void start();
+    
+    //Worker side: publishes the worker's counts so far
+    void publish(int worker, const RoundStats& stats){
+        slots[worker]->publish(stats);
+    }
+    
+    //Worker side: true once the interval is narrow enough and the workers should stop after their block
+    bool stopRequested() const{
+        return stopping.load(std::memory_order_relaxed);
+    }
+    
+    //Stops the monitor thread, writes the last snapshot and returns every worker's counts merged
+    RoundStats finish();
+    
+    //Merges what every worker has published so far
+    RoundStats merged() const;
+};
+
+#endif
@@ -0,0 +1,196 @@
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+#include "Card.h"
+#include "Hand.h"
+#include <cstdint>
+
+//What a strategy table tells a seat to do
+enum Action : uint8_t{
+    HIT,
+    STAND,
+    DOUBLE, //Double if the rules allow it, otherwise hit
+    DOUBLE_STAND, //Double if the rules allow it, otherwise stand
+    SPLIT //Split the pair if the rules allow it, otherwise play the hand by its total
+};
+
+//Highest hand total a table row exists for. Busted hands never look up a decision
+const int STRATEGY_ROWS = 22;
+
+//StrategyTable holds a decision for every player total, soft or hard, and every pair, against every dealer upcard (by value index, 2 through ace)
+struct StrategyTable{
+    Action hard[STRATEGY_ROWS][VALUE_COUNT] = {};
+    Action soft[STRATEGY_ROWS][VALUE_COUNT] = {};
+    Action pairs[VALUE_COUNT][VALUE_COUNT] = {}; //Indexed by the value index of the paired card
+};
+
+//Builds the multi-deck basic strategy table (dealer stands on soft 17, double after split allowed). Runs at compile time, so the table is plain constant data in the program
+constexpr StrategyTable makeBasicStrategy(){
+    StrategyTable table;
+    for(int up = 0; up < VALUE_COUNT; up++){
+        int dealer = up + 2; //Dealer upcard value, 11 for an ace
+        bool weak = dealer >= 2 && dealer <= 6; //Dealer 2-6 busts most often
+        
+        for(int total = 0; total < STRATEGY_ROWS; total++){
+            //Hard totals
+            Action hard = HIT;
+            if(total >= 17){
+                hard = STAND;
+            }else if(total >= 13){
+                hard = weak ? STAND : HIT;
+            }else if(total == 12){
+                hard = dealer >= 4 && dealer <= 6 ? STAND : HIT;
+            }else if(total == 11){
+                hard = dealer <= 10 ? DOUBLE : HIT;
+            }else if(total == 10){
+                hard = dealer <= 9 ? DOUBLE : HIT;
+            }else if(total == 9){
+                hard = dealer >= 3 && dealer <= 6 ? DOUBLE : HIT;
+            }
+            table.hard[total][up] = hard;
+            
+            //Soft totals (an ace counted as 11)
+            Action soft = HIT;
+            if(total >= 19){
+                soft = STAND;
+            }else if(total == 18){
+                soft = dealer >= 3 && dealer <= 6 ? DOUBLE_STAND : dealer <= 8 ? STAND : HIT;
+            }else if(total == 17){
+                soft = dealer >= 3 && dealer <= 6 ? DOUBLE : HIT;
+            }else if(total >= 15){
+                soft = dealer >= 4 && dealer <= 6 ? DOUBLE : HIT;
+            }else if(total >= 13){
+                soft = dealer >= 5 && dealer <= 6 ? DOUBLE : HIT;
+            }
+            table.soft[total][up] = soft;
+        }
+        
+        //Pairs, by the value of the paired card. A pair that shouldn't be split plays by its total
+        for(int pair = 0; pair < VALUE_COUNT; pair++){
+            int card = pair + 2;
+            bool split = false;
+            if(card == 11 || card == 8){
+                split = true;
+            }else if(card == 9){
+                split = dealer != 7 && dealer != 10 && dealer != 11;
+            }else if(card == 7 || card == 2 || card == 3){
+                split = dealer <= 7;
+            }else if(card == 6){
+                split = weak;
+            }else if(card == 4){
+                split = dealer == 5 || dealer == 6;
+            }
+            table.pairs[pair][up] = split ? SPLIT : card == 11 ? table.soft[12][up] : table.hard[card * 2][up];
+        }
+    }
+    return table;
+}
+
+//Basic strategy, generated at compile time
+inline constexpr StrategyTable BASIC_STRATEGY = makeBasicStrategy();
+
+//StrategyParams struct holds the stand thresholds a strategy table can be built from. Doubles and splits stay as in basic strategy; only when to stop hitting changes
+struct StrategyParams{
+    int8_t hardStand[VALUE_COUNT] = {}; //Lowest hard total (12 or more) the seat stands on, by dealer upcard
+    int8_t softStand = 19; //Lowest soft total the seat stands on
+};
+
+//Builds the strategy table for a set of stand thresholds, starting from basic strategy. A double that the thresholds turn into a stand becomes double-or-stand, and the other way around
+constexpr StrategyTable makeStrategy(const StrategyParams& params){
+    StrategyTable table = BASIC_STRATEGY;
+    for(int up = 0; up < VALUE_COUNT; up++){
+        for(int total = 12; total < STRATEGY_ROWS; total++){
+            table.hard[total][up] = total >= params.hardStand[up] ? STAND : HIT;
+        }
+        for(int total = 13; total < STRATEGY_ROWS; total++){
+            Action& soft = table.soft[total][up];
+            bool stand = total >= params.softStand;
+            if(soft == DOUBLE || soft == DOUBLE_STAND){
+                soft = stand ? DOUBLE_STAND : DOUBLE;
+            }else{
+                soft = stand ? STAND : HIT;
+            }
+        }
+        
+        //Pairs that aren't split play by their total, so they follow the new rows
+        for(int pair = 0; pair < VALUE_COUNT; pair++){
+            if(table.pairs[pair][up] != SPLIT){
+                int card = pair + 2;
+                table.pairs[pair][up] = card == 11 ? table.soft[12][up] : table.hard[card * 2][up];
+            }
+        }
+    }
+    return table;
+}
+
+//Looks up the table's decision for a hand against the dealer's upcard (by value index). Pairs are only looked up when the seat may split
+inline Action lookupAction(const StrategyTable& table, const Hand& hand, int upcard, bool canSplit){
+    if(canSplit && hand.size() == 2 && valueIndex(hand.card(0).rank()) == valueIndex(hand.card(1).rank())){
+        Action action = table.pairs[valueIndex(hand.card(0).rank())][upcard];
+        if(action == SPLIT){
+            return SPLIT;
+        }
+    }
+    return hand.isSoft() ? table.soft[hand.getTotal()][upcard] : table.hard[hand.getTotal()][upcard];
+}
+
+//Turns an action into hit (true) or stand (false) for a seat that can't double or split
+inline bool shouldHit(Action action){
+    return action == HIT || action == DOUBLE;
+}
+
+//Index play of a counting seat: at a true count of index or more it plays atOrAbove, below that it plays below
+struct CountIndex{
+    bool used = false;
+    int8_t index = 0;
+    Action atOrAbove = STAND;
+    Action below = HIT;
+};
+
+//DeviationTable holds the index plays for hard totals against every dealer upcard (by value index). Hands without an index play follow the strategy table
+struct DeviationTable{
+    CountIndex hard[STRATEGY_ROWS][VALUE_COUNT] = {};
+};
+
+//Builds the Hi-Lo index plays for a multi-deck shoe where the dealer stands on soft 17 (the hard-total plays of the "Illustrious 18"). Runs at compile time like the basic strategy table
+constexpr DeviationTable makeHiLoDeviations(){
+    DeviationTable table;
+    struct Play{
+        int total;
+        int dealer; //Dealer upcard value, 11 for an ace
+        int index;
+        Action atOrAbove;
+    };
+    const Play plays[] = {
+        {16, 10, 0, STAND}, {15, 10, 4, STAND}, {16, 9, 5, STAND},
+        {13, 2, -1, STAND}, {13, 3, -2, STAND},
+        {12, 2, 3, STAND}, {12, 3, 2, STAND}, {12, 4, 0, STAND}, {12, 5, -2, STAND}, {12, 6, -1, STAND},
+        {11, 11, 1, DOUBLE}, {10, 10, 4, DOUBLE}, {10, 11, 4, DOUBLE},
+        {9, 2, 1, DOUBLE}, {9, 7, 3, DOUBLE}
+    };
+    for(const Play& play : plays){
+        CountIndex& entry = table.hard[play.total][play.dealer - 2];
+        entry.used = true;
+        entry.index = (int8_t)play.index;
+        entry.atOrAbove = play.atOrAbove;
+        entry.below = HIT;
+    }
+    return table;
+}
+
+//Hi-Lo index plays, generated at compile time
+inline constexpr DeviationTable HI_LO_DEVIATIONS = makeHiLoDeviations();
+
+//Changes the table's decision for a hand to the index play for the true count, if there is one. Splits and soft hands are left alone
+inline Action deviateAction(const DeviationTable& table, Action action, const Hand& hand, int upcard, int trueCount){
+    if(action == SPLIT || hand.isSoft()){
+        return action;
+    }
+    const CountIndex& entry = table.hard[hand.getTotal()][upcard];
+    if(!entry.used){
+        return action;
+    }
+    return trueCount >= entry.index ? entry.atOrAbove : entry.below;
+}
+
+#endif
@@ -0,0 +1,294 @@
+#include "Table.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+using namespace std;
+
+Table::Table(const SimulationConfig& tableConfig, const string& tableName, uint64_t stream, Verbosity verbosity, ShoeFeeder* feeder) : config(tableConfig), name(tableName), shoe(tableConfig.decks, tableConfig.penetration, tableConfig.seed, stream), table(MAX_TABLE_SEATS), render(verbosity, screen){
+    if(feeder){
+        shoe.attach(*feeder);
+    }
+}
+
+void Table::broadcast(vector<TableMessage>& out){
+    render.flush();
+    string frame = screen.str();
+    screen.str("");
+    if(frame.empty()){
+        return;
+    }
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].occupied && seats[i].human && !seats[i].leaving){
+            out.push_back({seats[i].conn, frame});
+        }
+    }
+}
+
+int Table::seatOf(uint64_t conn) const{
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].occupied && seats[i].human && seats[i].conn == conn){
+            return i;
+        }
+    }
+    return -1;
+}
+
+void Table::clearSeat(int seat){
+    seats[seat] = Seat();
+    table.clearSeat(seat);
+}
+
+string Table::seatName(int seat){
+    return seats[seat].human ? seats[seat].player.getName() : "AI " + to_string(seat + 1);
+}
+
+bool Table::join(uint64_t conn, const string& name, vector<TableMessage>& out){
+    //Players sit down between rounds in the first empty seat
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(!seats[i].occupied){
+            clearSeat(i);
+            seats[i].occupied = true;
+            seats[i].human = true;
+            seats[i].conn = conn;
+            seats[i].player = Player(name);
+            render.result(name + " sits down at seat " + to_string(i + 1) + (inRound ? " and plays from the next round" : "") + ".");
+            broadcast(out);
+            return true;
+        }
+    }
+    out.push_back({conn, "ERR table is full\n", name});
+    return false;
+}
+
+void Table::leave(uint64_t conn, vector<TableMessage>& out){
+    int seat = seatOf(conn);
+    if(seat < 0){
+        return;
+    }
+    render.result(seats[seat].player.getName() + " leaves the table.");
+    if(!inRound){
+        clearSeat(seat);
+        broadcast(out);
+        return;
+    }
+    //A player who leaves mid-round stands, and the seat is emptied once the round is settled
+    seats[seat].leaving = true;
+    broadcast(out);
+    if(turn == seat){
+        advance(seat + 1, out);
+    }
+}
+
+bool Table::empty() const{
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].occupied && seats[i].human && !seats[i].leaving){
+            return false;
+        }
+    }
+    return true;
+}
+
+void Table::deal(vector<TableMessage>& out){
+    if(checkDeckSize(shoe)){
+        render.line("----Cut card reached. Reshuffling the shoe.----");
+    }
+    
+    //Same order as the interactive game: two cards to every seat, two to the dealer, then the dealer plays
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        seats[i].playing = seats[i].occupied;
+        if(seats[i].occupied){
+            Seat& s = seats[i];
+            if(s.human){
+                s.player.resetHand();
+                s.player.addCard(shoe);
+                s.player.addCard(shoe);
+            }else{
+                s.bot.resetHand();
+                s.bot.addCard(shoe);
+                s.bot.addCard(shoe);
+            }
+        }
+    }
+    dealer.resetHand();
+    dealer.addCard(shoe);
+    dealer.addCard(shoe);
+    dealerNatural = dealer.hasBlackjack();
+    dealer.play(shoe, config.hitSoft17);
+    inRound = true;
+    
+    render.line("--------------------");
+    render.line("Dealers hand: ");
+    dealer.printHand(render, false);
+    if(dealerNatural){
+        render.line("Dealer has blackjack!");
+    }
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].playing && seats[i].human){
+            render.line(seatName(i) + "'s Hand:");
+            seats[i].player.printHand(render);
+            render.line("Total: " + to_string(seats[i].player.calculateHT()));
+        }
+    }
+    broadcast(out);
+    advance(dealerNatural ? MAX_TABLE_SEATS : 0, out); //Nobody plays against a dealer natural
+}
+
+void Table::advance(int from, vector<TableMessage>& out){
+    for(turn = from; turn < MAX_TABLE_SEATS; turn++){
+        Seat& s = seats[turn];
+        if(s.playing && s.human && !s.leaving && !s.player.checkBust()){
+            //Waits for this player; everyone else is told whose turn it is
+            for(int i = 0; i < MAX_TABLE_SEATS; i++){
+                if(seats[i].occupied && seats[i].human && !seats[i].leaving){
+                    out.push_back({seats[i].conn, i == turn ? "Hit or Stay? (h/s):\n" : "Waiting for " + s.player.getName() + "\n"});
+                }
+            }
+            return;
+        }
+    }
+    finishRound(out);
+}
+
+void Table::decide(int seat, bool hit, vector<TableMessage>& out){
+    Player& p = seats[seat].player;
+    if(!hit){
+        render.line(p.getName() + " stays with their total: " + to_string(p.calculateHT()));
+        broadcast(out);
+        advance(seat + 1, out);
+        return;
+    }
+    p.addCard(shoe);
+    render.line(p.getName() + "'s hand:");
+    p.printHand(render);
+    render.line("New total: " + to_string(p.calculateHT()));
+    if(p.checkBust()){
+        render.line(p.getName() + " Busted");
+        broadcast(out);
+        advance(seat + 1, out);
+        return;
+    }
+    broadcast(out);
+    advance(seat, out);
+}
+
+void Table::finishRound(vector<TableMessage>& out){
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].playing && !seats[i].human){
+            if(!dealerNatural){
+                seats[i].bot.play<HitStandRules>(shoe, dealer.getUpcard());
+            }
+            render.line(seatName(i) + "'s Hand:");
+            seats[i].bot.printHand(render);
+            render.line(seatName(i) + " Total: " + to_string(seats[i].bot.calculateHT()));
+        }
+    }
+    render.line("Dealer reveals face-down card:");
+    dealer.printHand(render, true);
+    
+    //Settles every seat in one pass, like the interactive game
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].playing){
+            table.record(i, seats[i].human ? seats[i].player.getHand() : seats[i].bot.getHand());
+        }else{
+            table.skip(i);
+        }
+    }
+    table.settle(dealer.getTotal(), dealerNatural, config.sixToFive ? PAY_6_TO_5 : PAY_3_TO_2);
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(!seats[i].playing){
+            continue;
+        }
+        seats[i].playing = false;
+        string name = seatName(i);
+        if(table.isBust(i)){
+            render.result(name + " busted. Dealer wins.");
+        }else if(dealer.checkBust()){
+            render.result("The dealer has busted. " + name + " won!");
+        }else if(table.getResult(i) < 0){
+            render.result(name + "'s hand is less than the dealers. Dealer wins.");
+        }else if(table.getResult(i) > 0){
+            render.result(name + " wins!");
+        }else{
+            render.result("The dealer ties with " + name + ". ");
+        }
+    }
+    render.result("Type DEAL to play another round.");
+    inRound = false;
+    broadcast(out);
+    
+    for(int i = 0; i < MAX_TABLE_SEATS; i++){
+        if(seats[i].leaving){
+            clearSeat(i);
+        }
+    }
+}
+
+void Table::command(uint64_t conn, const string& line, vector<TableMessage>& out){
+    int seat = seatOf(conn);
+    if(seat < 0 || seats[seat].leaving){
+        return;
+    }
+    
+    //Splits the line into the command word (upper-cased) and its argument
+    istringstream words(line);
+    string word, argument;
+    words >> word >> argument;
+    transform(word.begin(), word.end(), word.begin(), [](unsigned char c){ return toupper(c); });
+    
+    if(word == "H" || word == "HIT" || word == "S" || word == "STAND" || word == "STAY"){
+        if(!inRound || turn != seat){
+            out.push_back({conn, "ERR it isn't your turn\n"});
+            return;
+        }
+        decide(seat, word[0] == 'H', out);
+    }else if(word == "DEAL"){
+        if(inRound){
+            out.push_back({conn, "ERR a round is already being played\n"});
+            return;
+        }
+        deal(out);
+    }else if(word == "AI"){
+        if(inRound){
+            out.push_back({conn, "ERR the AI seats can only change between rounds\n"});
+            return;
+        }
+        //Fills empty seats with AIs up to the number asked for, or empties AI seats down to it
+        int wanted = atoi(argument.c_str());
+        int bots = 0;
+        for(int i = 0; i < MAX_TABLE_SEATS; i++){
+            if(seats[i].occupied && !seats[i].human){
+                if(bots < wanted){
+                    bots++;
+                }else{
+                    clearSeat(i);
+                }
+            }
+        }
+        for(int i = 0; i < MAX_TABLE_SEATS && bots < wanted; i++){
+            if(!seats[i].occupied){
+                clearSeat(i);
+                seats[i].occupied = true;
+                bots++;
+            }
+        }
+        render.result("The table now has " + to_string(bots) + " AI seat(s).");
+        broadcast(out);
+    }else if(word == "SCORES"){
+        ostringstream scores;
+        Renderer scoreRender(SUMMARY_ONLY, scores);
+        for(int i = 0; i < MAX_TABLE_SEATS; i++){
+            if(seats[i].occupied){
+                scoreRender.result("--------------------");
+                scoreRender.result(seatName(i) + " Stats:");
+                table.printScores(scoreRender, i);
+            }
+        }
+        scoreRender.flush();
+        out.push_back({conn, scores.str()});
+    }else if(word == "LEAVE"){
+        leave(conn, out);
+    }else{
+        out.push_back({conn, "ERR unknown command " + word + "\n"});
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef TABLE_H
+#define TABLE_H
+
+#include "AI.h"
+#include "Dealer.h"
+#include "Player.h"
+#include "Renderer.h"
+#include "SeatTable.h"
+#include "Shoe.h"
+#include "ShoeFeeder.h"
+#include "Simulation.h"
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+const int MAX_TABLE_SEATS = 7; //Seats at one server table, players and AIs together
+
+//Text for one connection, produced by a table
+struct TableMessage{
+    uint64_t conn;
+    std::string text;
+    std::string detach = ""; //Name of the table the connection couldn't sit down at, so it's no longer there. Empty for every other message
+};
+
+//Table class is one table of the game server: the same round as the interactive game, but driven one command at a time instead of waiting on input. Every command runs to the next point where the table needs a player's decision, then returns, so a table waiting on a human costs no thread at all
+//Commands: DEAL starts a round, H/HIT and S/STAND answer the player whose turn it is, AI N sets the number of AI seats, SCORES shows every seat's score, LEAVE gets up from the table
+class Table{
+private:
+    //A seat holds a human player (reached through its connection), an AI, or nobody
+    struct Seat{
+        bool occupied = false;
+        bool human = false;
+        bool playing = false; //Dealt into the round being played. Someone who sits down mid-round waits for the next one
+        bool leaving = false; //The player left during a round and is removed once it's over
+        uint64_t conn = 0;
+        Player player{""};
+        AI bot;
+    };
+    
+    SimulationConfig config;
+    std::string name;
+    Shoe shoe;
+    Dealer dealer;
+    Seat seats[MAX_TABLE_SEATS];
+    SeatTable table; //Indexed by seat number; seats not in the round are skipped when it's settled
+    std::ostringstream screen; //Frames rendered for everyone at the table
+    Renderer render;
+    bool inRound = false;
+    bool dealerNatural = false;
+    int turn = 0; //Seat whose decision the table is waiting for
+    
+    //Sends everything rendered since the last call to every human at the table
+    void broadcast(std::vector<TableMessage>& out);
+    
+    //Moves the turn to the next human who still has to play, starting at seat from. Once everyone has played, the AIs play and the round is settled
+    void advance(int from, std::vector<TableMessage>& out);
+    
+    //Plays the AIs, reveals the dealer, settles the round and reports every seat's result
+    void finishRound(std::vector<TableMessage>& out);
+    
+    //Starts a round for everyone seated
+    void deal(std::vector<TableMessage>& out);
+    
+    //Handles a hit or stand from the player whose turn it is
+    void decide(int seat, bool hit, std::vector<TableMessage>& out);
+    
+    //Returns the seat of a connection, or -1
+    int seatOf(uint64_t conn) const;
+    
+    //Empties a seat and its score counters
+    void clearSeat(int seat);
+    
+    //Returns the name a seat is shown with
+    std::string seatName(int seat);
+public:
+    //Builds an empty table called name. Its shoe is shuffled from the config's seed on its own stream, so the same table name deals the same cards in every run. With a feeder the shoe's reshuffles are prepared ahead of time, and the feeder must outlive the table
+    Table(const SimulationConfig& tableConfig, const std::string& tableName, uint64_t stream, Verbosity verbosity, ShoeFeeder* feeder = nullptr);
+    
+    Table(const Table&) = delete; //The renderer points into the table, so it's never copied or moved
+    Table& operator=(const Table&) = delete;
+    
+    //Seats a player for the connection. Returns false if the table is full
+    bool join(uint64_t conn, const std::string& name, std::vector<TableMessage>& out);
+    
+    //Gets the connection's player up from the table
+    void leave(uint64_t conn, std::vector<TableMessage>& out);
+    
+    //Runs one command line from a seated connection
+    void command(uint64_t conn, const std::string& line, std::vector<TableMessage>& out);
+    
+    //Returns true once no human is seated, so the table can be closed
+    bool empty() const;
+};
+
+#endif
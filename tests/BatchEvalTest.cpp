@@ -0,0 +1,35 @@
+#include "BatchEval.h"
+#include "Check.h"
+#include "Rng.h"
+
+using namespace std;
+
+//Every kernel agrees with the Hand class on random hands, including kernels this CPU can't run (which fall back to one it can)
+static void testKernelsMatchHand(){
+    const int HANDS = 1000;
+    Rng rng(11);
+    vector<Hand> hands(HANDS);
+    HandBatch batch;
+    batch.reset(HANDS);
+    for(int i = 0; i < HANDS; i++){
+        int cards = 1 + rng.below(7);
+        for(int c = 0; c < cards; c++){
+            hands[i].add(Card(rng.below(RANK_COUNT), rng.below(SUIT_COUNT)));
+        }
+        batch.set(i, hands[i]);
+    }
+    for(BatchKernel kernel : {KERNEL_AUTO, KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2}){
+        BatchResult result;
+        evaluateHands(batch, result, kernel);
+        int wrong = 0;
+        for(int i = 0; i < HANDS; i++){
+            wrong += result.totals[i] != hands[i].getTotal() || result.soft[i] != hands[i].isSoft() || result.bust[i] != hands[i].isBust();
+        }
+        CHECK(wrong == 0);
+    }
+}
+
+int main(){
+    testKernelsMatchHand();
+    return checkFailures();
+}
@@ -0,0 +1,20 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <iostream>
+
+//CHECK reports a failed condition with its file and line and carries on, so one run shows every failure. A test's main returns checkFailures() as its exit status
+inline int& checkFailures(){
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition) \
+    do{ \
+        if(!(condition)){ \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            checkFailures()++; \
+        } \
+    }while(false)
+
+#endif
@@ -0,0 +1,98 @@
+#include "Check.h"
+#include "Checkpoint.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+const char* const PATH = "CheckpointTest.tmp";
+
+//Saves a slot with its scores under a given block number, so each save can be told apart
+static void saveBlock(Checkpoint& checkpoint, int64_t block){
+    CheckpointProgress progress;
+    progress.nextBlock = block;
+    progress.shoe.cursor = block * 10;
+    SeatTable table(2);
+    table.setScore(0, {block, 1, 2, block + 3, block * 5});
+    table.setScore(1, {0, block, 0, block, -block * 10});
+    checkpoint.save(0, progress, table);
+}
+
+//Resumes the checkpoint and returns the block of the progress it loads, or -1 if there's none
+static int64_t loadBlock(){
+    Checkpoint checkpoint;
+    if(!checkpoint.resume(PATH, CHECKPOINT_SIMULATION)){
+        return -1;
+    }
+    CheckpointProgress progress;
+    SeatTable table(2);
+    if(!checkpoint.load(0, progress, table)){
+        return -1;
+    }
+    //The scores and shoe come from the same copy as the block
+    CHECK(progress.shoe.cursor == progress.nextBlock * 10);
+    CHECK(table.getWins(0) == progress.nextBlock);
+    CHECK(table.getNet(1) == -progress.nextBlock * 10);
+    return progress.nextBlock;
+}
+
+//Saves twice, then leaves the newer copy as a crash in the middle of its write would: its number cleared and its contents half changed. Resuming must fall back to the older copy
+static void testTornRecordResumesOlderCopy(){
+    remove(PATH);
+    SimulationConfig config;
+    config.seed = 7;
+    config.rounds = 1000;
+    CheckpointHeader header = makeCheckpointHeader(CHECKPOINT_SIMULATION, config, 2, 0, 1);
+    {
+        Checkpoint checkpoint;
+        CHECK(checkpoint.create(PATH, header, false));
+        CHECK(loadBlock() == -1); //Nothing saved yet
+        saveBlock(checkpoint, 5);
+        saveBlock(checkpoint, 6);
+    }
+    CHECK(loadBlock() == 6);
+    
+    //The second save went to copy 0, which follows the header (there are no player names)
+    {
+        fstream file(PATH, ios::in | ios::out | ios::binary);
+        file.seekp(sizeof(CheckpointHeader));
+        uint64_t unfinished = 0;
+        file.write((const char*)&unfinished, sizeof(unfinished));
+        int64_t halfWritten = 99;
+        file.write((const char*)&halfWritten, sizeof(halfWritten)); //nextBlock of the torn copy
+    }
+    CHECK(loadBlock() == 5);
+    
+    //Saving again after resuming overwrites the torn copy and leaves the good one alone
+    {
+        Checkpoint checkpoint;
+        CHECK(checkpoint.resume(PATH, CHECKPOINT_SIMULATION));
+        saveBlock(checkpoint, 7);
+    }
+    CHECK(loadBlock() == 7);
+    remove(PATH);
+}
+
+//A checkpoint is never created over a file that already has something in it, unless asked to replace it
+static void testCreateKeepsExistingFile(){
+    {
+        ofstream file(PATH);
+        file << "not a checkpoint";
+    }
+    SimulationConfig config;
+    CheckpointHeader header = makeCheckpointHeader(CHECKPOINT_SIMULATION, config, 1, 0, 1);
+    Checkpoint checkpoint;
+    CHECK(!Checkpoint::isFree(PATH));
+    CHECK(!checkpoint.create(PATH, header, false));
+    CHECK(!checkpoint.resume(PATH, CHECKPOINT_SIMULATION));
+    CHECK(checkpoint.create(PATH, header, true));
+    checkpoint.close();
+    remove(PATH);
+}
+
+int main(){
+    testTornRecordResumesOlderCopy();
+    testCreateKeepsExistingFile();
+    return checkFailures();
+}
@@ -0,0 +1,91 @@
+#include "Check.h"
+#include "DealerOdds.h"
+#include "Rng.h"
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+//Value a card adds with aces counted as 1
+static int hardValue(int v){
+    return v == ACE_VALUE_INDEX ? 1 : v + 2;
+}
+
+//Best total of a hand given its total with aces as 1
+static int bestTotal(int hard, bool hasAce){
+    return hasAce && hard <= 11 ? hard + 10 : hard;
+}
+
+//Deals rounds of one decision from a seeded shoe and checks the engine's stand and hit EVs against their averages
+//The round is only played when the dealer has no natural, as in the game, and after the hit the player stands
+static void testDecisionMatchesSimulation(int playerHard, int upcard){
+    ShoeComposition shoe = ShoeComposition::fullShoe(1);
+    shoe.counts[TEN_VALUE_INDEX]--; //Player's 10
+    shoe.counts[playerHard - 12]--; //Player's second card, playerHard - 10
+    shoe.counts[upcard]--;
+    DealerOdds odds;
+    DecisionEV ev = odds.decisionEV(playerHard, false, upcard, shoe);
+    
+    vector<int> cards;
+    for(int v = 0; v < VALUE_COUNT; v++){
+        cards.insert(cards.end(), shoe.counts[v], v);
+    }
+    Rng rng(21);
+    const int ROUNDS = 400000;
+    double stand = 0;
+    double hit = 0;
+    int played = 0;
+    while(played < ROUNDS){
+        //Draws cards one at a time without replacement
+        size_t next = 0;
+        auto draw = [&](){
+            swap(cards[next], cards[next + rng.below(cards.size() - next)]);
+            return cards[next++];
+        };
+        int hole = draw();
+        if(hardValue(upcard) + hardValue(hole) == 11 && (upcard == ACE_VALUE_INDEX || hole == ACE_VALUE_INDEX)){
+            continue; //Dealer natural: nobody plays
+        }
+        played++;
+        int playerCard = draw();
+        int dealerHard = hardValue(upcard) + hardValue(hole);
+        bool dealerAce = upcard == ACE_VALUE_INDEX || hole == ACE_VALUE_INDEX;
+        while(bestTotal(dealerHard, dealerAce) < 17){
+            int card = draw();
+            dealerHard += hardValue(card);
+            dealerAce |= card == ACE_VALUE_INDEX;
+        }
+        int dealer = bestTotal(dealerHard, dealerAce);
+        dealer = dealer > 21 ? 0 : dealer;
+        stand += playerHard > dealer ? 1 : playerHard < dealer ? -1 : 0;
+        int hitTotal = bestTotal(playerHard + hardValue(playerCard), playerCard == ACE_VALUE_INDEX);
+        hit += hitTotal > 21 ? -1 : hitTotal > dealer ? 1 : hitTotal < dealer ? -1 : 0;
+    }
+    stand /= ROUNDS;
+    hit /= ROUNDS;
+    CHECK(fabs(ev.stand - stand) < 0.01);
+    CHECK(fabs(ev.hit - hit) < 0.01);
+}
+
+//A natural the dealer peeked for never reaches the player, so a player's 21 can't push against it
+static void testPeekedAceHasNoNatural(){
+    ShoeComposition shoe = ShoeComposition::fullShoe(6);
+    shoe.counts[ACE_VALUE_INDEX]--;
+    DealerOdds odds;
+    DealerDistribution open = odds.dealerOutcomes(ACE_VALUE_INDEX, shoe);
+    DealerDistribution peeked = odds.dealerOutcomes(ACE_VALUE_INDEX, shoe, true);
+    double sum = 0;
+    for(double p : peeked){
+        sum += p;
+    }
+    CHECK(fabs(sum - 1) < 1e-9);
+    CHECK(peeked[FINAL_21] < open[FINAL_21] - 0.25); //About 30% of aces hide a ten
+}
+
+int main(){
+    testDecisionMatchesSimulation(16, TEN_VALUE_INDEX); //16 against a 10: every card after the hit leaves a total the player stands on
+    testDecisionMatchesSimulation(17, ACE_VALUE_INDEX);
+    testPeekedAceHasNoNatural();
+    return checkFailures();
+}
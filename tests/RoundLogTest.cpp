@@ -0,0 +1,96 @@
+#include "Check.h"
+#include "RoundLog.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const char* const PATH = "RoundLogTest.tmp";
+
+//Reads every event of the log. Sets error if the log is cut off or corrupt
+static vector<LogRecord> readAll(string& error){
+    vector<LogRecord> records;
+    LogReader reader;
+    if(!reader.open(PATH)){
+        error = "can't open";
+        return records;
+    }
+    LogRecord record;
+    while(reader.next(record, error)){
+        records.push_back(record);
+    }
+    return records;
+}
+
+//Writes one round and reads it back event by event
+static void testRoundTrip(){
+    remove(PATH);
+    {
+        LogFile file;
+        CHECK(file.open(PATH));
+        RoundLog log(&file);
+        log.table(0x0123456789ABCDEFULL, 6, 2, LOG_HIT_SOFT_17 | LOG_CAN_SPLIT);
+        log.block(1ULL << 40);
+        log.shuffle();
+        log.round();
+        log.opening(0, Card(12, 0), Card(8, 3)); //A natural
+        log.opening(DEALER_SEAT, Card(5, 1), Card(9, 2));
+        Hand hand;
+        hand.add(Card(0, 0));
+        hand.add(Card(1, 1));
+        hand.add(Card(7, 2)); //Hit once, then stood
+        log.opening(1, hand.card(0), hand.card(1));
+        log.turn(1, hand, false);
+        log.result(0, 1, 15);
+        log.result(1, -1, -300); //A net that needs both bytes
+        CHECK(log.flush());
+    }
+    
+    string error;
+    vector<LogRecord> records = readAll(error);
+    CHECK(error.empty());
+    const LogEvent expected[] = {EVENT_TABLE, EVENT_BLOCK, EVENT_SHUFFLE, EVENT_ROUND, EVENT_DEAL, EVENT_DEAL, EVENT_DEAL, EVENT_DEAL, EVENT_DEAL, EVENT_DEAL, EVENT_HIT, EVENT_DEAL, EVENT_STAND, EVENT_RESULT, EVENT_RESULT};
+    CHECK(records.size() == sizeof(expected) / sizeof(expected[0]));
+    if(records.size() != sizeof(expected) / sizeof(expected[0])){
+        return;
+    }
+    for(size_t i = 0; i < records.size(); i++){
+        CHECK(records[i].tag == expected[i]);
+    }
+    CHECK(records[0].value == 0x0123456789ABCDEFULL);
+    CHECK(records[0].decks == 6);
+    CHECK(records[0].seats == 2);
+    CHECK(records[0].rules == (LOG_HIT_SOFT_17 | LOG_CAN_SPLIT));
+    CHECK(records[1].value == 1ULL << 40);
+    CHECK(records[4].seat == 0 && records[4].card.bits == Card(12, 0).bits);
+    CHECK(records[7].seat == DEALER_SEAT && records[7].card.bits == Card(9, 2).bits);
+    CHECK(records[11].seat == 1 && records[11].card.bits == Card(7, 2).bits);
+    CHECK(records[13].seat == 0 && records[13].outcome == 1 && records[13].net == 15);
+    CHECK(records[14].seat == 1 && records[14].outcome == -1 && records[14].net == -300);
+}
+
+//A log cut off in the middle of an event is reported, not read as a shorter log
+static void testTruncatedLog(){
+    string bytes;
+    {
+        ifstream in(PATH, ios::binary);
+        bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }
+    CHECK(bytes.size() > 2);
+    {
+        ofstream out(PATH, ios::binary | ios::trunc);
+        out.write(bytes.data(), bytes.size() - 2);
+    }
+    string error;
+    readAll(error);
+    CHECK(!error.empty());
+    remove(PATH);
+}
+
+int main(){
+    testRoundTrip();
+    testTruncatedLog();
+    return checkFailures();
+}
@@ -0,0 +1,29 @@
+#include "Check.h"
+#include "Stats.h"
+#include <cmath>
+
+using namespace std;
+
+//Merging the accumulators of several threads gives the same mean and variance as one accumulator that saw every sample
+static void testWelfordMerge(){
+    Welford all;
+    Welford parts[3];
+    for(int i = 0; i < 1000; i++){
+        double x = (i * 37 % 101) / 10.0 - 5;
+        all.add(x);
+        parts[i % 7 == 0 ? 0 : i < 400 ? 1 : 2].add(x);
+    }
+    Welford merged;
+    merged.merge(Welford()); //An empty accumulator changes nothing
+    for(const Welford& part : parts){
+        merged.merge(part);
+    }
+    CHECK(merged.n == all.n);
+    CHECK(fabs(merged.mean - all.mean) < 1e-12);
+    CHECK(fabs(merged.variance() - all.variance()) < 1e-9);
+}
+
+int main(){
+    testWelfordMerge();
+    return checkFailures();
+}
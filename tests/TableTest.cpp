@@ -0,0 +1,56 @@
+#include "Check.h"
+#include "Table.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//Returns everything the table sent to one connection
+static string textFor(const vector<TableMessage>& out, uint64_t conn){
+    string text;
+    for(const TableMessage& message : out){
+        if(message.conn == conn){
+            text += message.text;
+        }
+    }
+    return text;
+}
+
+//A player who sits down while a round is being played isn't scored for it
+static void testJoinMidRound(){
+    SimulationConfig config;
+    config.preshuffle = false;
+    for(config.seed = 1; config.seed < 100; config.seed++){
+        Table table(config, "T", 0, SUMMARY_ONLY);
+        vector<TableMessage> out;
+        table.join(1, "Alice", out);
+        out.clear();
+        table.command(1, "DEAL", out);
+        if(textFor(out, 1).find("Hit or Stay?") == string::npos){
+            continue; //The dealer had a natural and the round is already over
+        }
+        table.join(2, "Bob", out);
+        table.command(1, "S", out);
+        out.clear();
+        table.command(2, "SCORES", out);
+        string scores = textFor(out, 2);
+        size_t alice = scores.find("Alice Stats:");
+        size_t bob = scores.find("Bob Stats:");
+        CHECK(alice != string::npos);
+        CHECK(bob != string::npos);
+        if(alice == string::npos || bob == string::npos){
+            return;
+        }
+        CHECK(scores.find("Wins: 0\nLosses: 0\nTies: 0\nNet: +0.0 bets", bob) != string::npos);
+        string aliceScores = scores.substr(alice, bob - alice);
+        int played = (aliceScores.find("Wins: 1") != string::npos) + (aliceScores.find("Losses: 1") != string::npos) + (aliceScores.find("Ties: 1") != string::npos);
+        CHECK(played == 1);
+        return;
+    }
+    CHECK(!"no seed left the round waiting on the player");
+}
+
+int main(){
+    testJoinMidRound();
+    return checkFailures();
+}